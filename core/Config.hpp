@@ -8,6 +8,17 @@ constexpr int kLandingParticlePoolSize = 64;
 
 constexpr float kFixedDt = 1.0f / 120.0f;
 constexpr float kMaxFrameTime = 0.25f;
+constexpr int kMaxSimStepsPerFrame = 8; // Backlog beyond this is dropped
+
+// Frame pacing (render rate; the sim always steps at kFixedDt).
+// Preset values: kFrameRateDisplay = monitor refresh, 0 = uncapped.
+constexpr int kFrameRateDisplay = -1;
+constexpr int kFrameRatePresets[] = {kFrameRateDisplay, 60, 120, 144, 240, 0};
+constexpr int kFrameRatePresetCount =
+    sizeof(kFrameRatePresets) / sizeof(kFrameRatePresets[0]);
+constexpr int kDefaultFrameRatePreset = 0;
+constexpr float kFramePacerMinSpinMs = 0.25f; // Spin at least this long
+constexpr float kFramePacerMaxSpinMs = 4.0f;  // Never spin longer than this
 
 constexpr float kForwardSpeed = 18.0f;
 constexpr float kStrafeSpeed = 9.0f;
@@ -48,7 +59,7 @@ constexpr float kLandingParticleDrag = 5.5f;
 constexpr float kBloomOverlayAlpha = 0.18f;
 
 // --- Visual scene dressing (render-only, no sim impact) ---
-constexpr int kStarCount = 400;
+constexpr int kStarCount = 400; // One prefab draw; cost is build time only
 constexpr float kStarFieldRadius = 120.0f;
 constexpr float kStarFieldHeight = 80.0f;
 constexpr float kStarFieldDepth = 200.0f;
@@ -68,12 +79,31 @@ constexpr int kGridLateralLines = 22; // cross-hatch lines visible around player
 constexpr float kGridLateralSpacing = 2.0f; // Z spacing of lateral grid lines
 constexpr int kGridLongitudinalCount = 7;   // longitudinal lines across width
 
+constexpr float kBakedGridLineWidth = 0.03f; // Longitudinal lines as quads
+
+constexpr float kLevelDrawDistance = 80.0f;    // Segment Z distance from player
+constexpr float kLevelMeshChunkLength = 50.0f; // Z span of one baked chunk
+constexpr float kMeshUploadBudgetMs = 1.0f;    // Endless chunk uploads/frame
+constexpr int kLevelPreloadSlots = 4;          // Level meshes built ahead
+constexpr int kFileWatchPollMs = 250;          // Level hot reload latency
+
+// Level of detail (render/Lod): tier thresholds on projected diameter.
+constexpr float kLodReducedPx = 96.0f;  // Below: drop shells, caps, sparkles
+constexpr float kLodMinimalPx = 40.0f;  // Below: bodies only
+constexpr float kLodHysteresis = 0.15f; // Band around each threshold
+
+constexpr int kScreenshotQueueSlots = 3; // Pooled readback buffers in flight
+constexpr int kFrameRecorderSlots = 4;   // Video frames between GPU and disk
+
 constexpr float kNeonEdgeWidth = 0.18f;
 constexpr float kNeonEdgeHeight = 0.09f;
 
 constexpr float kShipModelScale = 0.7f;
 
-constexpr int kExhaustParticleCount = 48;
+constexpr int kCubeBatchCapacity = 4096; // Instances queued before a flush
+constexpr int kPrefabInstanceCapacity = 64; // Instances per prefab draw
+
+constexpr int kExhaustParticleCount = 256;
 constexpr float kExhaustParticleLife = 0.35f;
 constexpr float kExhaustSpreadX = 0.15f;
 constexpr float kExhaustSpreadY = 0.1f;
@@ -171,6 +201,10 @@ struct KeyConfig {
   int restartNew = 78;    // KEY_N
   int cyclePalette = 291; // KEY_F2
   int toggleBloom = 292;  // KEY_F3
+  int togglePerfOverlay = 293; // KEY_F4
+  int cycleFrameRate = 294;    // KEY_F5
+  int toggleSimThread = 295;   // KEY_F6
+  int toggleRecording = 300;   // KEY_F11
   int screenshot = 301;   // KEY_F12
   int backspace = 259;    // KEY_BACKSPACE
 };
@@ -0,0 +1,126 @@
+#include "core/FileWatcher.hpp"
+
+#include <utility>
+
+#include "core/Config.hpp"
+#include "core/Log.hpp"
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#else
+#include <chrono>
+#include <filesystem>
+#include <map>
+#endif
+
+namespace core {
+
+namespace {
+
+#if defined(__linux__)
+
+bool OpenWatch(FileWatcher &watcher) {
+  watcher.inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (watcher.inotifyFd < 0)
+    return false;
+  if (inotify_add_watch(watcher.inotifyFd, watcher.directory.c_str(),
+                        IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+    close(watcher.inotifyFd);
+    watcher.inotifyFd = -1;
+    return false;
+  }
+  return true;
+}
+
+void CloseWatch(FileWatcher &watcher) {
+  if (watcher.inotifyFd >= 0)
+    close(watcher.inotifyFd);
+  watcher.inotifyFd = -1;
+}
+
+// Blocks in poll() for at most cfg::kFileWatchPollMs so a stop request is
+// seen without a wake-up pipe.
+void WatchLoop(FileWatcher &watcher) {
+  alignas(inotify_event) char buf[4096];
+  pollfd pfd = {watcher.inotifyFd, POLLIN, 0};
+  while (!watcher.stopping.load(std::memory_order_acquire)) {
+    if (poll(&pfd, 1, cfg::kFileWatchPollMs) <= 0)
+      continue;
+    const ssize_t len = read(watcher.inotifyFd, buf, sizeof(buf));
+    for (ssize_t off = 0; off < len;) {
+      const auto *event = reinterpret_cast<const inotify_event *>(buf + off);
+      if (event->len > 0 && !(event->mask & IN_ISDIR))
+        watcher.onChanged(event->name);
+      off += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+    }
+  }
+}
+
+#else
+
+namespace fs = std::filesystem;
+
+using WriteTimes = std::map<std::string, fs::file_time_type>;
+
+WriteTimes ScanDirectory(const std::string &directory) {
+  WriteTimes times;
+  std::error_code ec;
+  for (const fs::directory_entry &entry :
+       fs::directory_iterator(directory, ec)) {
+    if (entry.is_regular_file(ec))
+      times[entry.path().filename().string()] = entry.last_write_time(ec);
+  }
+  return times;
+}
+
+bool OpenWatch(FileWatcher &watcher) {
+  std::error_code ec;
+  return fs::is_directory(watcher.directory, ec);
+}
+
+void CloseWatch(FileWatcher &) {}
+
+void WatchLoop(FileWatcher &watcher) {
+  WriteTimes known = ScanDirectory(watcher.directory);
+  while (!watcher.stopping.load(std::memory_order_acquire)) {
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(cfg::kFileWatchPollMs));
+    WriteTimes current = ScanDirectory(watcher.directory);
+    for (const auto &[name, time] : current) {
+      const auto it = known.find(name);
+      if (it == known.end() || it->second != time)
+        watcher.onChanged(name);
+    }
+    known = std::move(current);
+  }
+}
+
+#endif
+
+} // namespace
+
+bool StartFileWatcher(FileWatcher &watcher, const char *directory,
+                      FileChangedFn onChanged) {
+  StopFileWatcher(watcher);
+  watcher.directory = directory;
+  watcher.onChanged = std::move(onChanged);
+  if (!OpenWatch(watcher)) {
+    LOG_WARN("Cannot watch {} for changes", directory);
+    return false;
+  }
+  watcher.stopping.store(false, std::memory_order_relaxed);
+  watcher.thread = std::thread(WatchLoop, std::ref(watcher));
+  return true;
+}
+
+void StopFileWatcher(FileWatcher &watcher) {
+  if (!watcher.thread.joinable())
+    return;
+  watcher.stopping.store(true, std::memory_order_release);
+  watcher.thread.join();
+  CloseWatch(watcher);
+}
+
+} // namespace core
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+
+// Watches one directory for files that were written or moved in, and reports
+// them by name on a watcher thread. Uses inotify on Linux (IN_CLOSE_WRITE and
+// IN_MOVED_TO, so editors that save through a temp file and rename are seen
+// once the file is complete); elsewhere it compares modification times every
+// cfg::kFileWatchPollMs.
+
+namespace core {
+
+// Called on the watcher thread with the changed file's name (no directory).
+using FileChangedFn = std::function<void(const std::string &name)>;
+
+struct FileWatcher {
+  std::thread thread;
+  std::atomic<bool> stopping{false};
+  std::string directory;
+  FileChangedFn onChanged;
+  int inotifyFd = -1; // Linux only
+};
+
+// False (and no thread) if `directory` can't be watched.
+bool StartFileWatcher(FileWatcher &watcher, const char *directory,
+                      FileChangedFn onChanged);
+
+// Stop and join the watcher thread. No-op if it isn't running.
+void StopFileWatcher(FileWatcher &watcher);
+
+} // namespace core
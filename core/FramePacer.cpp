@@ -0,0 +1,73 @@
+#include "core/FramePacer.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#include "core/Config.hpp"
+
+namespace core {
+
+namespace {
+
+using Clock = FramePacer::Clock;
+
+float ToMs(Clock::duration d) {
+    return std::chrono::duration<float, std::milli>(d).count();
+}
+
+Clock::duration FromMs(float ms) {
+    return std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<float, std::milli>(ms));
+}
+
+}  // namespace
+
+void SetFramePacerTarget(FramePacer& pacer, int targetFps) {
+    pacer.targetFps = std::max(0, targetFps);
+    pacer.period = (pacer.targetFps > 0)
+                       ? std::chrono::duration_cast<Clock::duration>(
+                             std::chrono::duration<double>(1.0 / pacer.targetFps))
+                       : Clock::duration{};
+    pacer.deadline = Clock::now();
+    pacer.lastJitterMs = 0.0f;
+    pacer.missedDeadlines = 0;
+}
+
+void WaitForNextFrame(FramePacer& pacer) {
+    const auto now = Clock::now();
+    if (pacer.targetFps <= 0) {
+        pacer.deadline = now;
+        pacer.lastJitterMs = 0.0f;
+        return;
+    }
+
+    pacer.deadline += pacer.period;
+
+    // Frame overran its budget: report the lateness and restart the schedule
+    // from now rather than rushing the next frames to catch up.
+    if (pacer.deadline <= now) {
+        pacer.lastJitterMs = ToMs(now - pacer.deadline);
+        pacer.deadline = now;
+        ++pacer.missedDeadlines;
+        return;
+    }
+
+    // Coarse phase: sleep until shortly before the deadline.
+    const auto sleepUntil = pacer.deadline - FromMs(pacer.spinMarginMs);
+    if (sleepUntil > now) {
+        std::this_thread::sleep_until(sleepUntil);
+        const float oversleepMs = ToMs(Clock::now() - sleepUntil);
+        pacer.avgOversleepMs += (oversleepMs - pacer.avgOversleepMs) * 0.1f;
+        pacer.spinMarginMs =
+            std::clamp(pacer.avgOversleepMs * 2.0f, cfg::kFramePacerMinSpinMs,
+                       cfg::kFramePacerMaxSpinMs);
+    }
+
+    // Fine phase: spin out the remainder.
+    while (Clock::now() < pacer.deadline) {
+    }
+
+    pacer.lastJitterMs = ToMs(Clock::now() - pacer.deadline);
+}
+
+}  // namespace core
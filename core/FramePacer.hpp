@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+
+// Hybrid sleep/spin frame limiter.
+//
+// Sleeps through most of the remaining frame budget, then spins for the last
+// stretch to hit the deadline precisely. The spin margin adapts to how much
+// the OS oversleeps, so on a coarse scheduler we spin a little longer and on
+// a precise one we give more time back to the CPU.
+//
+// Call WaitForNextFrame() once per frame after presenting.
+
+namespace core {
+
+struct FramePacer {
+    using Clock = std::chrono::steady_clock;
+
+    int targetFps = 0;  // 0 = uncapped
+    Clock::duration period{};
+    Clock::time_point deadline{};
+
+    float spinMarginMs = 1.0f;   // Adaptive; see cfg::kFramePacer*SpinMs
+    float avgOversleepMs = 0.0f; // Smoothed sleep_until overshoot
+
+    // Wake time minus deadline for the last frame. Positive = late.
+    // A frame that overran its budget reports how late it finished.
+    float lastJitterMs = 0.0f;
+    unsigned long long missedDeadlines = 0;
+};
+
+// Change the target rate (0 = uncapped). Restarts the deadline schedule.
+void SetFramePacerTarget(FramePacer& pacer, int targetFps);
+
+// Block until the next frame deadline.
+void WaitForNextFrame(FramePacer& pacer);
+
+}  // namespace core
@@ -0,0 +1,79 @@
+#include "core/FrameStats.hpp"
+
+#include <algorithm>
+
+namespace perf {
+
+namespace {
+
+// Nearest-rank percentile; partially reorders `values`.
+float NthValue(float* values, int count, float pct) {
+    int rank = static_cast<int>(pct * static_cast<float>(count));
+    rank = std::clamp(rank, 0, count - 1);
+    std::nth_element(values, values + rank, values + count);
+    return values[rank];
+}
+
+}  // namespace
+
+void PushFrameSample(FrameHistory& history, const FrameSample& sample) {
+    history.samples[history.head] = sample;
+    history.head = (history.head + 1) % kFrameHistorySize;
+    if (history.count < kFrameHistorySize) {
+        ++history.count;
+    }
+
+    ++history.totalFrames;
+    if (sample.simClamped) {
+        ++history.clampedFrames;
+    }
+}
+
+const FrameSample& GetFrameSample(const FrameHistory& history, int age) {
+    const int oldest = (history.head - history.count + kFrameHistorySize) % kFrameHistorySize;
+    return history.samples[(oldest + age) % kFrameHistorySize];
+}
+
+FramePercentiles ComputeFramePercentiles(const FrameHistory& history,
+                                         float FrameSample::*field) {
+    FramePercentiles result;
+    if (history.count == 0) {
+        return result;
+    }
+
+    std::array<float, kFrameHistorySize> scratch;
+    for (int i = 0; i < history.count; ++i) {
+        scratch[i] = history.samples[i].*field;
+    }
+
+    float* values = scratch.data();
+    const int n = history.count;
+    result.max = *std::max_element(values, values + n);
+    result.p50 = NthValue(values, n, 0.50f);
+    result.p95 = NthValue(values, n, 0.95f);
+    result.p99 = NthValue(values, n, 0.99f);
+    return result;
+}
+
+float AverageSimSteps(const FrameHistory& history) {
+    if (history.count == 0) {
+        return 0.0f;
+    }
+    int total = 0;
+    for (int i = 0; i < history.count; ++i) {
+        total += history.samples[i].simSteps;
+    }
+    return static_cast<float>(total) / static_cast<float>(history.count);
+}
+
+int CountClampedFrames(const FrameHistory& history) {
+    int clamped = 0;
+    for (int i = 0; i < history.count; ++i) {
+        if (history.samples[i].simClamped) {
+            ++clamped;
+        }
+    }
+    return clamped;
+}
+
+}  // namespace perf
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Rolling per-frame timing history for the perf overlay. The main loop
+// pushes gameplay frames only, so menus and pauses don't skew percentiles.
+// Fixed-size ring buffer; pushing and querying never touch the heap.
+
+namespace perf {
+
+constexpr int kFrameHistorySize = 256;
+
+struct FrameSample {
+    float frameMs = 0.0f;   // Wall time of the whole frame (unclamped)
+    float simMs = 0.0f;     // Time spent in sim steps
+    float renderMs = 0.0f;  // Time spent in RenderFrame
+    float pacerJitterMs = 0.0f;  // Frame pacer wake time minus deadline
+    int simSteps = 0;       // Fixed steps run this frame
+    bool simClamped = false;  // kMaxSimStepsPerFrame hit, accumulator dropped
+};
+
+struct FrameHistory {
+    std::array<FrameSample, kFrameHistorySize> samples{};
+    int head = 0;   // Next write slot
+    int count = 0;  // Valid samples (<= kFrameHistorySize)
+
+    // Lifetime counters, not limited to the window.
+    uint64_t totalFrames = 0;
+    uint64_t clampedFrames = 0;
+};
+
+struct FramePercentiles {
+    float p50 = 0.0f;
+    float p95 = 0.0f;
+    float p99 = 0.0f;
+    float max = 0.0f;
+};
+
+void PushFrameSample(FrameHistory& history, const FrameSample& sample);
+
+// Sample by age: 0 = oldest in the window, count-1 = newest.
+const FrameSample& GetFrameSample(const FrameHistory& history, int age);
+
+// Percentiles of one field over the current window.
+FramePercentiles ComputeFramePercentiles(const FrameHistory& history,
+                                         float FrameSample::*field);
+
+// Windowed sim step summary.
+float AverageSimSteps(const FrameHistory& history);
+int CountClampedFrames(const FrameHistory& history);
+
+}  // namespace perf
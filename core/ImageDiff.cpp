@@ -0,0 +1,101 @@
+#include "core/ImageDiff.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace core {
+
+namespace {
+
+// Largest squared YIQ distance between any two colours with the weights
+// below (pixelmatch's constant).
+constexpr float kMaxYiqDelta = 35215.0f;
+
+float Luma(const unsigned char *p) {
+  return 0.29889531f * p[0] + 0.58662247f * p[1] + 0.11448223f * p[2];
+}
+
+// Does any pixel of `image` within `radius` of (x, y) match `pixel`?
+bool HasMatchNear(const unsigned char *image, int width, int height, int x,
+                  int y, int radius, const unsigned char *pixel,
+                  float threshold) {
+  const int x0 = std::max(x - radius, 0);
+  const int x1 = std::min(x + radius, width - 1);
+  const int y0 = std::max(y - radius, 0);
+  const int y1 = std::min(y + radius, height - 1);
+  for (int ny = y0; ny <= y1; ++ny) {
+    for (int nx = x0; nx <= x1; ++nx) {
+      const size_t i = (static_cast<size_t>(ny) * width + nx) * 4;
+      if (PixelDelta(image + i, pixel) <= threshold)
+        return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+float PixelDelta(const unsigned char *a, const unsigned char *b) {
+  const float r1 = a[0], g1 = a[1], b1 = a[2];
+  const float r2 = b[0], g2 = b[1], b2 = b[2];
+  const float dy = Luma(a) - Luma(b);
+  const float di = 0.59597799f * (r1 - r2) - 0.27417610f * (g1 - g2) -
+                   0.32180189f * (b1 - b2);
+  const float dq = 0.21147017f * (r1 - r2) - 0.52261711f * (g1 - g2) +
+                   0.31114694f * (b1 - b2);
+  const float d = 0.5053f * dy * dy + 0.299f * di * di + 0.1957f * dq * dq;
+  return std::min(std::sqrt(d / kMaxYiqDelta), 1.0f);
+}
+
+ImageDiffResult DiffImages(const unsigned char *expected,
+                           const unsigned char *actual, int width, int height,
+                           const ImageDiffOptions &options,
+                           unsigned char *heatmap) {
+  ImageDiffResult result;
+  result.width = width;
+  result.height = height;
+  double deltaSum = 0.0;
+
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      const size_t i = (static_cast<size_t>(y) * width + x) * 4;
+      const float delta = PixelDelta(expected + i, actual + i);
+      deltaSum += delta;
+
+      unsigned char *out = heatmap ? heatmap + i : nullptr;
+      if (out) {
+        const auto gray = static_cast<unsigned char>(Luma(expected + i) / 4);
+        out[0] = out[1] = out[2] = gray;
+        out[3] = 255;
+      }
+      if (delta <= options.threshold)
+        continue;
+
+      const bool shifted =
+          options.radius > 0 &&
+          HasMatchNear(expected, width, height, x, y, options.radius,
+                       actual + i, options.threshold) &&
+          HasMatchNear(actual, width, height, x, y, options.radius,
+                       expected + i, options.threshold);
+      if (shifted) {
+        ++result.shiftedPixels;
+      } else {
+        ++result.differentPixels;
+        result.maxDelta = std::max(result.maxDelta, delta);
+      }
+      if (out) {
+        out[0] = 255;
+        out[1] = shifted ? 220
+                         : static_cast<unsigned char>(160.0f * (1.0f - delta));
+        out[2] = 0;
+      }
+    }
+  }
+
+  const double total = static_cast<double>(width) * height;
+  result.meanDelta = total > 0.0 ? deltaSum / total : 0.0;
+  return result;
+}
+
+} // namespace core
@@ -0,0 +1,45 @@
+#pragma once
+
+// Tolerant image comparison for golden-image tests.
+//
+// Pixels are compared by their perceptual distance in YIQ space (luma
+// weighted over chroma), normalised by the largest possible distance. A pixel
+// whose distance exceeds the threshold still counts as shifted rather than
+// different when each image has a matching pixel for the other within a
+// small radius, so rasterisation moving an edge by a pixel doesn't fail a
+// comparison while a missing or recoloured object does.
+
+namespace core {
+
+struct ImageDiffOptions {
+  float threshold = 0.1f; // Per-pixel distance above which pixels differ
+  int radius = 1;         // Neighbourhood searched for shifted pixels
+};
+
+struct ImageDiffResult {
+  int width = 0;
+  int height = 0;
+  int differentPixels = 0;
+  int shiftedPixels = 0;
+  float maxDelta = 0.0f;  // Largest distance among different pixels
+  double meanDelta = 0.0; // Over all pixels
+
+  double DifferentFraction() const {
+    const double total = static_cast<double>(width) * height;
+    return total > 0.0 ? differentPixels / total : 0.0;
+  }
+};
+
+// Perceptual distance between two RGB(A) pixels, 0 to 1. Alpha is ignored.
+float PixelDelta(const unsigned char *a, const unsigned char *b);
+
+// Compare two RGBA8 images of the same size. When `heatmap` is given it
+// receives an RGBA8 image of the same size: the expected image darkened,
+// shifted pixels in yellow and different ones from orange to red by
+// distance.
+ImageDiffResult DiffImages(const unsigned char *expected,
+                           const unsigned char *actual, int width, int height,
+                           const ImageDiffOptions &options,
+                           unsigned char *heatmap = nullptr);
+
+} // namespace core
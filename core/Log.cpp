@@ -6,7 +6,10 @@
 
 namespace Log {
 
-static std::shared_ptr<spdlog::logger> s_Logger;
+// Sink-less until Init, so tools that never call it (sim_runner) can reach
+// code that logs.
+static std::shared_ptr<spdlog::logger> s_Logger =
+    std::make_shared<spdlog::logger>("SKYROADS");
 
 void Init() {
   std::vector<spdlog::sink_ptr> sinks;
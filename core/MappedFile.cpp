@@ -0,0 +1,86 @@
+#include "core/MappedFile.hpp"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace core {
+
+#if defined(_WIN32)
+
+bool MapFile(const char *path, MappedFile &file) {
+  file = {};
+  HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (handle == INVALID_HANDLE_VALUE)
+    return false;
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(handle, &size) || size.QuadPart <= 0) {
+    CloseHandle(handle);
+    return false;
+  }
+  HANDLE mapping =
+      CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  const void *view =
+      mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+  if (!view) {
+    if (mapping)
+      CloseHandle(mapping);
+    CloseHandle(handle);
+    return false;
+  }
+  file.data = static_cast<const unsigned char *>(view);
+  file.size = static_cast<size_t>(size.QuadPart);
+  file.fileHandle = handle;
+  file.mappingHandle = mapping;
+  return true;
+}
+
+void UnmapFile(MappedFile &file) {
+  if (file.data) {
+    UnmapViewOfFile(file.data);
+    CloseHandle(static_cast<HANDLE>(file.mappingHandle));
+    CloseHandle(static_cast<HANDLE>(file.fileHandle));
+  }
+  file = {};
+}
+
+#else
+
+bool MapFile(const char *path, MappedFile &file) {
+  file = {};
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    close(fd);
+    return false;
+  }
+  const size_t size = static_cast<size_t>(st.st_size);
+  void *view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping keeps its own reference to the file.
+  close(fd);
+  if (view == MAP_FAILED)
+    return false;
+  file.data = static_cast<const unsigned char *>(view);
+  file.size = size;
+  return true;
+}
+
+void UnmapFile(MappedFile &file) {
+  if (file.data)
+    munmap(const_cast<unsigned char *>(file.data), file.size);
+  file = {};
+}
+
+#endif
+
+} // namespace core
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+
+// Read-only memory mapping of a whole file (mmap, or MapViewOfFile on
+// Windows). The bytes stay valid until UnmapFile.
+
+namespace core {
+
+struct MappedFile {
+  const unsigned char *data = nullptr;
+  size_t size = 0;
+#if defined(_WIN32)
+  void *fileHandle = nullptr;
+  void *mappingHandle = nullptr;
+#endif
+};
+
+// False (leaving `file` empty) if the file is missing, empty or can't be
+// mapped.
+bool MapFile(const char *path, MappedFile &file);
+void UnmapFile(MappedFile &file);
+
+} // namespace core
@@ -0,0 +1,80 @@
+#include "core/ParticleSystem.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SKYROADS_PARTICLE_SSE 1
+#else
+#define SKYROADS_PARTICLE_SSE 0
+#endif
+
+namespace core {
+
+namespace {
+
+// Velocity kept after one step of damping. Large drag * dt stops the
+// particle instead of reversing it.
+float Retain(float drag, float dt) {
+  const float t = drag * dt;
+  if (t <= 0.0f)
+    return 1.0f;
+  return t >= 1.0f ? 0.0f : 1.0f - t;
+}
+
+} // namespace
+
+void IntegrateParticles(float *px, float *py, float *pz, float *vx,
+                        float *vy, float *vz, float *life, int count,
+                        const ParticleMotion &motion, float dt) {
+  const float kx = Retain(motion.drag.x, dt);
+  const float ky = Retain(motion.drag.y, dt);
+  const float kz = Retain(motion.drag.z, dt);
+  const float fall = motion.gravity * dt;
+
+  int i = 0;
+#if SKYROADS_PARTICLE_SSE
+  const __m128 vdt = _mm_set1_ps(dt);
+  const __m128 vkx = _mm_set1_ps(kx);
+  const __m128 vky = _mm_set1_ps(ky);
+  const __m128 vkz = _mm_set1_ps(kz);
+  const __m128 vfall = _mm_set1_ps(fall);
+  const __m128 zero = _mm_setzero_ps();
+  for (; i + 4 <= count; i += 4) {
+    _mm_storeu_ps(life + i,
+                  _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(life + i), vdt), zero));
+    const __m128 ovx = _mm_loadu_ps(vx + i);
+    const __m128 ovy = _mm_loadu_ps(vy + i);
+    const __m128 ovz = _mm_loadu_ps(vz + i);
+    const __m128 nvx = _mm_mul_ps(ovx, vkx);
+    const __m128 nvy = _mm_add_ps(_mm_mul_ps(ovy, vky), vfall);
+    const __m128 nvz = _mm_mul_ps(ovz, vkz);
+    _mm_storeu_ps(vx + i, nvx);
+    _mm_storeu_ps(vy + i, nvy);
+    _mm_storeu_ps(vz + i, nvz);
+    const __m128 mvx = motion.moveFirst ? ovx : nvx;
+    const __m128 mvy = motion.moveFirst ? ovy : nvy;
+    const __m128 mvz = motion.moveFirst ? ovz : nvz;
+    _mm_storeu_ps(px + i,
+                  _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(mvx, vdt)));
+    _mm_storeu_ps(py + i,
+                  _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(mvy, vdt)));
+    _mm_storeu_ps(pz + i,
+                  _mm_add_ps(_mm_loadu_ps(pz + i), _mm_mul_ps(mvz, vdt)));
+  }
+#endif
+  for (; i < count; ++i) {
+    const float l = life[i] - dt;
+    life[i] = l > 0.0f ? l : 0.0f;
+    const float ovx = vx[i];
+    const float ovy = vy[i];
+    const float ovz = vz[i];
+    vx[i] = ovx * kx;
+    vy[i] = ovy * ky + fall;
+    vz[i] = ovz * kz;
+    px[i] += (motion.moveFirst ? ovx : vx[i]) * dt;
+    py[i] += (motion.moveFirst ? ovy : vy[i]) * dt;
+    pz[i] += (motion.moveFirst ? ovz : vz[i]) * dt;
+  }
+}
+
+} // namespace core
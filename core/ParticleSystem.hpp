@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstdint>
+
+#include <raylib.h>
+
+// Fixed-capacity particle pool with structure-of-arrays storage.
+//
+// Live particles are packed into [0, count): spawning appends and a dead
+// particle is swap-removed with the last live one, so Update and drawing
+// only ever touch live particles. Integration runs over the packed arrays
+// four particles at a time where SSE is available. Each pool has a single
+// ParticleMotion; effects with different motion use different pools.
+//
+// Because the cost scales with the live count rather than the capacity,
+// the capacities in cfg can be raised for heavier effects without slowing
+// down frames that don't use them. The pool is trivially copyable so it can
+// live in Game and travel in the sim thread's snapshots.
+
+namespace core {
+
+struct ParticleMotion {
+  Vector3 drag = {}; // Per-axis velocity damping per second
+  float gravity = 0.0f;
+  bool moveFirst = false; // Move with the old velocity, then damp
+};
+
+struct ParticleStats {
+  int capacity = 0;
+  int live = 0;
+  int peak = 0;         // Most live particles since the last Clear
+  uint32_t spawned = 0; // Since the last Clear
+  uint32_t dropped = 0; // Spawns refused because the pool was full
+};
+
+// Step packed particle arrays by `dt`: age, damp, apply gravity, then move
+// (or move first with ParticleMotion::moveFirst). Life is clamped at zero;
+// removing dead particles is up to the caller.
+void IntegrateParticles(float *px, float *py, float *pz, float *vx,
+                        float *vy, float *vz, float *life, int count,
+                        const ParticleMotion &motion, float dt);
+
+template <int Capacity> struct ParticleSystem {
+  float px[Capacity] = {};
+  float py[Capacity] = {};
+  float pz[Capacity] = {};
+  float vx[Capacity] = {};
+  float vy[Capacity] = {};
+  float vz[Capacity] = {};
+  float life[Capacity] = {};
+  float maxLife[Capacity] = {};
+  int count = 0;
+  int peak = 0;
+  uint32_t spawned = 0;
+  uint32_t dropped = 0;
+
+  bool Full() const { return count >= Capacity; }
+
+  // False if the pool is full.
+  bool Spawn(Vector3 position, Vector3 velocity, float lifetime) {
+    if (count >= Capacity) {
+      ++dropped;
+      return false;
+    }
+    const int i = count++;
+    px[i] = position.x;
+    py[i] = position.y;
+    pz[i] = position.z;
+    vx[i] = velocity.x;
+    vy[i] = velocity.y;
+    vz[i] = velocity.z;
+    life[i] = lifetime;
+    maxLife[i] = lifetime;
+    ++spawned;
+    if (count > peak)
+      peak = count;
+    return true;
+  }
+
+  // Like Spawn, but a full pool gives up the particle with the least life
+  // left instead of refusing, so a steady stream never detaches from its
+  // source when spawns outpace deaths.
+  void SpawnOrRecycle(Vector3 position, Vector3 velocity, float lifetime) {
+    if (count < Capacity) {
+      Spawn(position, velocity, lifetime);
+      return;
+    }
+    int i = 0;
+    for (int j = 1; j < count; ++j) {
+      if (life[j] < life[i])
+        i = j;
+    }
+    px[i] = position.x;
+    py[i] = position.y;
+    pz[i] = position.z;
+    vx[i] = velocity.x;
+    vy[i] = velocity.y;
+    vz[i] = velocity.z;
+    life[i] = lifetime;
+    maxLife[i] = lifetime;
+    ++spawned;
+  }
+
+  void Update(const ParticleMotion &motion, float dt) {
+    IntegrateParticles(px, py, pz, vx, vy, vz, life, count, motion, dt);
+    int i = 0;
+    while (i < count) {
+      if (life[i] > 0.0f) {
+        ++i;
+        continue;
+      }
+      const int last = --count;
+      px[i] = px[last];
+      py[i] = py[last];
+      pz[i] = pz[last];
+      vx[i] = vx[last];
+      vy[i] = vy[last];
+      vz[i] = vz[last];
+      life[i] = life[last];
+      maxLife[i] = maxLife[last];
+    }
+  }
+
+  void Clear() {
+    count = 0;
+    peak = 0;
+    spawned = 0;
+    dropped = 0;
+  }
+
+  Vector3 Position(int i) const { return {px[i], py[i], pz[i]}; }
+
+  ParticleStats Stats() const {
+    return {Capacity, count, peak, spawned, dropped};
+  }
+};
+
+} // namespace core
@@ -1,43 +1,167 @@
 #include "core/PerfTracker.hpp"
 
+#include <cstddef>
 #include <cstdlib>
 #include <new>
 
-// Override global new/delete in debug builds to count heap allocations.
-#ifndef NDEBUG
+namespace perf {
 
-void* operator new(std::size_t size) {
-    perf::g_allocCounter.fetch_add(1, std::memory_order_relaxed);
-    void* ptr = std::malloc(size);
-    if (!ptr) {
-        throw std::bad_alloc();
+const char* GetAllocTagName(AllocTag tag) {
+    switch (tag) {
+        case AllocTag::Untagged:    return "untagged";
+        case AllocTag::Sim:         return "sim";
+        case AllocTag::Generator:   return "generator";
+        case AllocTag::Render:      return "render";
+        case AllocTag::JsonLoad:    return "json_load";
+        case AllocTag::Leaderboard: return "leaderboard";
+        default:                    return "unknown";
     }
-    return ptr;
 }
 
-void* operator new[](std::size_t size) {
+}  // namespace perf
+
+// Override global new/delete to track heap allocations when tracking is on.
+#ifdef SKYROADS_PERF_TRACK_ALLOCS
+
+namespace {
+
+// Every tracked block is prefixed with a header recording its size and tag,
+// so delete can credit the right subsystem. Padded to max_align_t to keep the
+// user pointer suitably aligned.
+struct AllocHeader {
+    std::size_t size;
+    perf::AllocTag tag;
+};
+
+constexpr std::size_t kHeaderSize =
+    (sizeof(AllocHeader) + alignof(std::max_align_t) - 1) &
+    ~(alignof(std::max_align_t) - 1);
+
+struct TagCounters {
+    std::atomic<uint64_t> allocCount{0};
+    std::atomic<uint64_t> freeCount{0};
+    std::atomic<uint64_t> bytesAllocated{0};
+    std::atomic<int64_t> liveBytes{0};
+    std::atomic<int64_t> peakLiveBytes{0};
+};
+
+TagCounters g_tagCounters[perf::kAllocTagCount];
+std::atomic<int64_t> g_totalLiveBytes{0};
+std::atomic<int64_t> g_totalPeakLiveBytes{0};
+
+void RaisePeak(std::atomic<int64_t>& peak, int64_t value) {
+    int64_t current = peak.load(std::memory_order_relaxed);
+    while (value > current &&
+           !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void* TrackedAlloc(std::size_t size) {
+    void* raw = std::malloc(size + kHeaderSize);
+    if (!raw) {
+        throw std::bad_alloc();
+    }
+
+    const perf::AllocTag tag = perf::g_allocTag;
+    auto* header = static_cast<AllocHeader*>(raw);
+    header->size = size;
+    header->tag = tag;
+
     perf::g_allocCounter.fetch_add(1, std::memory_order_relaxed);
-    void* ptr = std::malloc(size);
+
+    const auto bytes = static_cast<int64_t>(size);
+    TagCounters& c = g_tagCounters[static_cast<int>(tag)];
+    c.allocCount.fetch_add(1, std::memory_order_relaxed);
+    c.bytesAllocated.fetch_add(size, std::memory_order_relaxed);
+    RaisePeak(c.peakLiveBytes,
+              c.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    RaisePeak(g_totalPeakLiveBytes,
+              g_totalLiveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+
+    return static_cast<char*>(raw) + kHeaderSize;
+}
+
+void TrackedFree(void* ptr) {
     if (!ptr) {
-        throw std::bad_alloc();
+        return;
+    }
+
+    void* raw = static_cast<char*>(ptr) - kHeaderSize;
+    const auto* header = static_cast<const AllocHeader*>(raw);
+    const auto bytes = static_cast<int64_t>(header->size);
+
+    TagCounters& c = g_tagCounters[static_cast<int>(header->tag)];
+    c.freeCount.fetch_add(1, std::memory_order_relaxed);
+    c.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    g_totalLiveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+
+    std::free(raw);
+}
+
+}  // namespace
+
+namespace perf {
+
+AllocStats GetAllocStats(AllocTag tag) {
+    const TagCounters& c = g_tagCounters[static_cast<int>(tag)];
+    AllocStats s;
+    s.allocCount = c.allocCount.load(std::memory_order_relaxed);
+    s.freeCount = c.freeCount.load(std::memory_order_relaxed);
+    s.bytesAllocated = c.bytesAllocated.load(std::memory_order_relaxed);
+    s.liveBytes = c.liveBytes.load(std::memory_order_relaxed);
+    s.peakLiveBytes = c.peakLiveBytes.load(std::memory_order_relaxed);
+    return s;
+}
+
+AllocStats GetTotalAllocStats() {
+    AllocStats total;
+    for (int i = 0; i < kAllocTagCount; ++i) {
+        const AllocStats s = GetAllocStats(static_cast<AllocTag>(i));
+        total.allocCount += s.allocCount;
+        total.freeCount += s.freeCount;
+        total.bytesAllocated += s.bytesAllocated;
+    }
+    total.liveBytes = g_totalLiveBytes.load(std::memory_order_relaxed);
+    total.peakLiveBytes = g_totalPeakLiveBytes.load(std::memory_order_relaxed);
+    return total;
+}
+
+void ResetAllocStats() {
+    for (TagCounters& c : g_tagCounters) {
+        c.allocCount.store(0, std::memory_order_relaxed);
+        c.freeCount.store(0, std::memory_order_relaxed);
+        c.bytesAllocated.store(0, std::memory_order_relaxed);
+        c.peakLiveBytes.store(c.liveBytes.load(std::memory_order_relaxed),
+                              std::memory_order_relaxed);
     }
-    return ptr;
+    g_totalPeakLiveBytes.store(g_totalLiveBytes.load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+}
+
+}  // namespace perf
+
+void* operator new(std::size_t size) {
+    return TrackedAlloc(size);
+}
+
+void* operator new[](std::size_t size) {
+    return TrackedAlloc(size);
 }
 
 void operator delete(void* ptr) noexcept {
-    std::free(ptr);
+    TrackedFree(ptr);
 }
 
 void operator delete[](void* ptr) noexcept {
-    std::free(ptr);
+    TrackedFree(ptr);
 }
 
 void operator delete(void* ptr, std::size_t) noexcept {
-    std::free(ptr);
+    TrackedFree(ptr);
 }
 
 void operator delete[](void* ptr, std::size_t) noexcept {
-    std::free(ptr);
+    TrackedFree(ptr);
 }
 
 #endif
@@ -1,26 +1,98 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <cstdio>
 
-// Lightweight per-frame heap allocation counter.
-// Active only in debug builds (NDEBUG not defined).
-// Call ResetAllocCounter() before Update(), then ReadAllocCounter() after.
+// Lightweight heap allocation tracker.
+//
+// Active in debug builds (NDEBUG not defined), or in any build when compiled
+// with SKYROADS_ALLOC_TRACKING (CMake option of the same name). When inactive
+// every call below compiles to a no-op and the global operator new is left
+// untouched.
+//
+// Per-frame counter: call ResetAllocCounter() before Update(), then
+// ReadAllocCounter() after.
+//
+// Per-subsystem stats: wrap work in an AllocScope to attribute allocations to
+// a tag. Scopes nest per thread; the innermost tag wins. Frees are credited
+// back to the tag that made the allocation, so live/peak bytes stay correct
+// even when memory crosses subsystems.
+
+#if !defined(NDEBUG) || defined(SKYROADS_ALLOC_TRACKING)
+#define SKYROADS_PERF_TRACK_ALLOCS 1
+#endif
 
 namespace perf {
 
-#ifndef NDEBUG
+enum class AllocTag : uint8_t {
+    Untagged = 0,
+    Sim,
+    Generator,
+    Render,
+    JsonLoad,
+    Leaderboard,
+    Count
+};
+
+constexpr int kAllocTagCount = static_cast<int>(AllocTag::Count);
+
+struct AllocStats {
+    uint64_t allocCount = 0;
+    uint64_t freeCount = 0;
+    uint64_t bytesAllocated = 0;
+    int64_t liveBytes = 0;
+    int64_t peakLiveBytes = 0;
+};
+
+const char* GetAllocTagName(AllocTag tag);
+
+#ifdef SKYROADS_PERF_TRACK_ALLOCS
+
+constexpr bool kAllocTrackingEnabled = true;
 
 inline std::atomic<int> g_allocCounter{0};
+inline thread_local AllocTag g_allocTag = AllocTag::Untagged;
 
 inline void ResetAllocCounter() { g_allocCounter.store(0, std::memory_order_relaxed); }
 inline int  ReadAllocCounter()  { return g_allocCounter.load(std::memory_order_relaxed); }
 
+// Snapshot of one tag's counters.
+AllocStats GetAllocStats(AllocTag tag);
+// Sum over all tags (peak is the global peak, not the sum of per-tag peaks).
+AllocStats GetTotalAllocStats();
+// Zero counts and bytes, and rebase peaks to the current live bytes.
+void ResetAllocStats();
+
+class AllocScope {
+public:
+    explicit AllocScope(AllocTag tag) : previous_(g_allocTag) { g_allocTag = tag; }
+    ~AllocScope() { g_allocTag = previous_; }
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+
+private:
+    AllocTag previous_;
+};
+
 #else
 
+constexpr bool kAllocTrackingEnabled = false;
+
 inline void ResetAllocCounter() {}
 inline int  ReadAllocCounter()  { return 0; }
 
+inline AllocStats GetAllocStats(AllocTag) { return {}; }
+inline AllocStats GetTotalAllocStats() { return {}; }
+inline void ResetAllocStats() {}
+
+class AllocScope {
+public:
+    explicit AllocScope(AllocTag) {}
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+};
+
 #endif
 
 }  // namespace perf
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Lock-free single-producer / single-consumer triple buffer.
+//
+// The writer always has a private back slot to fill and the reader a private
+// front slot to read; the third slot sits in the middle. Publish() swaps the
+// back slot into the middle, ReadLatest() swaps the middle into the front if
+// the writer has published since the last read. Neither side ever waits, and
+// the reader always sees the newest complete value.
+
+namespace core {
+
+template <typename T>
+class TripleBuffer {
+public:
+  // Writer side.
+  T &WriteSlot() { return slots_[back_]; }
+  void Publish() {
+    back_ = state_.exchange(back_ | kDirty, std::memory_order_acq_rel) &
+            kIndexMask;
+  }
+
+  // Reader side. Returns nullptr if nothing new was published.
+  const T *ReadLatest() {
+    if ((state_.load(std::memory_order_relaxed) & kDirty) == 0)
+      return nullptr;
+    front_ = state_.exchange(front_, std::memory_order_acq_rel) & kIndexMask;
+    return &slots_[front_];
+  }
+  const T &Front() const { return slots_[front_]; }
+
+  // Not thread-safe; only call while neither side is active.
+  void Reset() {
+    back_ = 0;
+    state_.store(1, std::memory_order_relaxed);
+    front_ = 2;
+  }
+
+private:
+  static constexpr uint8_t kIndexMask = 0x3;
+  static constexpr uint8_t kDirty = 0x4;
+
+  // Writer, shared and reader state on separate cache lines.
+  T slots_[3]{};
+  alignas(64) uint8_t back_ = 0;
+  alignas(64) std::atomic<uint8_t> state_{1}; // Middle slot index | kDirty
+  alignas(64) uint8_t front_ = 2;
+};
+
+} // namespace core
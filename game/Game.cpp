@@ -1,6 +1,7 @@
 #include "game/Game.hpp"
 
 #include "core/Config.hpp"
+#include "core/Log.hpp"
 #include "core/Rng.hpp"
 #include "render/Render.hpp"
 #include "sim/EndlessLevelGenerator.hpp"
@@ -105,8 +106,7 @@ void ResetRun(Game &game, const uint32_t seed, int levelIndex) {
   game.obstacleRevealActive = false;
   game.obstacleSurgePending = false;
 
-  for (auto &p : game.landingParticles)
-    p.active = false;
+  game.particles.Clear();
 
   RegenerateSpaceObjects(game.runSeed);
   game.screen = game.isPlaceholderLevel ? GameScreen::PlaceholderLevel
@@ -327,10 +327,18 @@ void ReadInput(Game &game) {
   // Global keys
   if (IsKeyPressed(k.screenshot))
     game.screenshotRequested = true;
+  if (IsKeyPressed(k.toggleRecording))
+    game.recordingToggleRequested = true;
   if (IsKeyPressed(k.cyclePalette))
     game.input.cyclePaletteQueued = true;
   if (IsKeyPressed(k.toggleBloom))
     game.input.toggleBloomQueued = true;
+  if (IsKeyPressed(k.togglePerfOverlay))
+    game.input.togglePerfOverlayQueued = true;
+  if (IsKeyPressed(k.cycleFrameRate))
+    game.input.cycleFrameRateQueued = true;
+  if (IsKeyPressed(k.toggleSimThread))
+    game.input.toggleSimThreadQueued = true;
 }
 
 void ApplyMetaActions(Game &game) {
@@ -351,4 +359,37 @@ void ApplyMetaActions(Game &game) {
     game.bloomEnabled = !game.bloomEnabled;
     game.input.toggleBloomQueued = false;
   }
+
+  if (game.input.togglePerfOverlayQueued) {
+    game.perfOverlayVisible = !game.perfOverlayVisible;
+    game.input.togglePerfOverlayQueued = false;
+  }
+
+  if (game.input.cycleFrameRateQueued) {
+    game.frameRatePreset =
+        (game.frameRatePreset + 1) % cfg::kFrameRatePresetCount;
+    ApplyFrameRatePreset(game);
+    game.input.cycleFrameRateQueued = false;
+  }
+
+  if (game.input.toggleSimThreadQueued) {
+    game.simThreadEnabled = !game.simThreadEnabled;
+    LOG_INFO("Sim thread {}", game.simThreadEnabled ? "enabled" : "disabled");
+    game.input.toggleSimThreadQueued = false;
+  }
+}
+
+void ApplyFrameRatePreset(Game &game) {
+  int fps = cfg::kFrameRatePresets[game.frameRatePreset];
+  if (fps == cfg::kFrameRateDisplay) {
+    fps = GetMonitorRefreshRate(GetCurrentMonitor());
+    if (fps <= 0)
+      fps = 60; // Unknown refresh rate (e.g. headless)
+  }
+  core::SetFramePacerTarget(game.framePacer, fps);
+  if (fps > 0) {
+    LOG_INFO("Frame pacer target: {} fps", fps);
+  } else {
+    LOG_INFO("Frame pacer target: uncapped");
+  }
 }
@@ -6,6 +6,9 @@
 #include <string>
 
 #include "core/Config.hpp"
+#include "core/FramePacer.hpp"
+#include "core/FrameStats.hpp"
+#include "core/ParticleSystem.hpp"
 #include "sim/Level.hpp"
 #include "sim/EndlessLevelGenerator.hpp"
 #include "sim/PowerUp.hpp"
@@ -42,14 +45,14 @@ struct InputState {
     bool restartNewQueued = false;
     bool cyclePaletteQueued = false;
     bool toggleBloomQueued = false;
+    bool togglePerfOverlayQueued = false;
+    bool cycleFrameRateQueued = false;
+    bool toggleSimThreadQueued = false;
 };
 
-struct LandingParticle {
-    bool active = false;
-    Vector3 position{};
-    Vector3 velocity{};
-    float life = 0.0f;
-};
+// Landing and power-up pickup bursts. Stepped with the sim so they stay in
+// lockstep with the run; engine exhaust is render-side (Render.cpp).
+using BurstParticles = core::ParticleSystem<cfg::kLandingParticlePoolSize>;
 
 struct LeaderboardEntry {
     char name[20] = "Player";
@@ -86,7 +89,7 @@ struct Game {
     Vector3 cameraTarget{};
     float cameraRollDeg = 0.0f;
     bool bloomEnabled = false;
-    std::array<LandingParticle, cfg::kLandingParticlePoolSize> landingParticles{};
+    BurstParticles particles{};
 
     bool runActive = true;
     bool runOver = false;
@@ -150,10 +153,23 @@ struct Game {
     float renderMs = 0.0f;
     int   updateAllocCount = 0;
 
-    // Screenshot notification
+    // Perf overlay (F4): rolling frame/sim/render timings
+    bool perfOverlayVisible = false;
+    perf::FrameHistory frameHistory{};
+
+    // Frame pacing (F5 cycles cfg::kFrameRatePresets)
+    int frameRatePreset = cfg::kDefaultFrameRatePreset;
+    core::FramePacer framePacer{};
+
+    // Run SimStep on a dedicated thread while playing (F6, see SimThread.hpp)
+    bool simThreadEnabled = false;
+
+    // Screenshot notification (also announces finished recordings)
     float screenshotNotificationTimer = 0.0f;
+    const char* screenshotNotificationTitle = "Screenshot saved!";
     char screenshotPath[256] = {};
     bool screenshotRequested = false;
+    bool recordingToggleRequested = false; // F11, see render/FrameRecorder
 
     // Power-up/debuff system
     std::array<ActiveEffect, 8> activeEffects{};  // Multiple effects can stack
@@ -170,6 +186,8 @@ struct Game {
 void InitGame(Game& game, uint32_t seed);
 void ReadInput(Game& game);
 void ApplyMetaActions(Game& game);
+// Resolve game.frameRatePreset and retarget the frame pacer. Needs a window.
+void ApplyFrameRatePreset(Game& game);
 void ResetRun(Game& game, uint32_t seed, int levelIndex = 1);
 float GetCurrentScore(const Game& game);
 void SubmitScore(Game& game);
@@ -1,6 +1,7 @@
 #include "game/Game.hpp"
 
 #include "core/Config.hpp"
+#include "core/PerfTracker.hpp"
 #include <cstdio>
 #include <cstring>
 #include <ctime>
@@ -59,6 +60,7 @@ float GetCurrentScore(const Game &game) {
 }
 
 void SubmitScore(Game &game) {
+  perf::AllocScope allocScope(perf::AllocTag::Leaderboard);
   float currentScore = GetCurrentScore(game);
   if (currentScore <= 0.0f)
     return;
@@ -97,6 +99,7 @@ void SubmitScore(Game &game) {
 }
 
 void FinalizeScoreEntry(Game &game) {
+  perf::AllocScope allocScope(perf::AllocTag::Leaderboard);
   if (!game.hasPendingScore || game.pendingEntryIndex == -1)
     return;
 
@@ -174,6 +177,7 @@ void CalculateLeaderboardStats(Game &game) {
 }
 
 void SaveLeaderboard(const Game &game) {
+  perf::AllocScope allocScope(perf::AllocTag::Leaderboard);
   // Save new format (v2) with multiple leaderboards
   FILE *f = std::fopen(kLeaderboardFileV2, "wb");
   if (!f)
@@ -223,6 +227,7 @@ void SaveLeaderboard(const Game &game) {
 }
 
 void LoadLeaderboard(Game &game) {
+  perf::AllocScope allocScope(perf::AllocTag::Leaderboard);
   // Try to load new format first
   FILE *f = std::fopen(kLeaderboardFileV2, "rb");
   if (f) {
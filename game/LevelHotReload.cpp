@@ -0,0 +1,85 @@
+#include "game/LevelHotReload.hpp"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "core/Assets.hpp"
+#include "core/FileWatcher.hpp"
+#include "core/Log.hpp"
+#include "game/Game.hpp"
+#include "render/LevelMesh.hpp"
+#include "render/LevelPreload.hpp"
+#include "sim/BuiltinLevels.hpp"
+#include "sim/Level.hpp"
+
+namespace {
+
+constexpr int kLevelSlots = 30; // Indexed by level index - 1
+
+// Filled by the watcher thread, emptied by ApplyLevelReloads. A newer save
+// replaces an unapplied one.
+std::atomic<Level *> g_pending[kLevelSlots] = {};
+
+core::FileWatcher g_watcher;
+
+void OnLevelFileChanged(const std::string &name) {
+  const std::string path = "levels/" + name;
+  const int levelIndex = FindBuiltinLevelIndex(path.c_str());
+  if (levelIndex == 0)
+    return;
+  auto level = std::make_unique<Level>();
+  if (!LoadLevelFromFile(*level, path.c_str())) {
+    LOG_WARN("Keeping the loaded {} until it parses again", path);
+    return;
+  }
+  delete g_pending[levelIndex - 1].exchange(level.release(),
+                                            std::memory_order_acq_rel);
+}
+
+} // namespace
+
+void StartLevelHotReload() {
+  if (core::StartFileWatcher(g_watcher, assets::Path("levels"),
+                             OnLevelFileChanged))
+    LOG_INFO("Watching {} for level edits", g_watcher.directory);
+}
+
+void StopLevelHotReload() {
+  core::StopFileWatcher(g_watcher);
+  for (std::atomic<Level *> &pending : g_pending)
+    delete pending.exchange(nullptr, std::memory_order_acquire);
+}
+
+bool LevelReloadPending() {
+  for (const std::atomic<Level *> &pending : g_pending) {
+    if (pending.load(std::memory_order_relaxed))
+      return true;
+  }
+  return false;
+}
+
+void ApplyLevelReloads(Game &game) {
+  for (int i = 0; i < kLevelSlots; ++i) {
+    std::unique_ptr<Level> level(
+        g_pending[i].exchange(nullptr, std::memory_order_acquire));
+    if (!level)
+      continue;
+    const int levelIndex = i + 1;
+    const Level &previous = GetLevelByIndex(levelIndex);
+    const Level &latest = ReplaceBuiltinLevel(levelIndex, *level);
+    // Both caches key on the Level's address, and ReplaceBuiltinLevel
+    // reuses its storage.
+    render::InvalidateLevelPreloads();
+    render::UnloadLevelMesh();
+
+    // Only per-run state derived from the level needs redoing; the player
+    // carries on from where they were.
+    if (!game.isEndlessMode && game.level == &previous) {
+      game.level = &latest;
+      game.isPlaceholderLevel = latest.finish.style == FinishStyle::None;
+    }
+    LOG_INFO("Reloaded {}", GetBuiltinLevelPath(levelIndex));
+  }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+struct Game;
+
+// Hot reload of the built-in levels' JSON (assets/levels/*.json).
+//
+// A core::FileWatcher thread reparses a built-in level (AssignVariants
+// included) as soon as its file is saved and leaves the result in that
+// level's mailbox, an atomic pointer. The main loop applies mailboxes between
+// ticks with the sim thread stopped: ReplaceBuiltinLevel copies the new Level
+// into what GetLevelByIndex returns, a run on that level switches to it in
+// place, and the level mesh and preloads are dropped and rebuilt. A file that
+// fails to parse is logged and the level stays as it was.
+
+// Start watching. Logs and does nothing if the level directory is missing.
+void StartLevelHotReload();
+
+// Stop the watcher thread and drop unapplied reloads.
+void StopLevelHotReload();
+
+// Main thread, cheap: whether a reparsed level waits to be applied.
+bool LevelReloadPending();
+
+// Main thread, between ticks and with the sim thread stopped.
+void ApplyLevelReloads(Game &game);
@@ -0,0 +1,229 @@
+#include "game/SimThread.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include "core/Config.hpp"
+#include "core/Log.hpp"
+#include "core/PerfTracker.hpp"
+#include "sim/Sim.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const Clock::duration kTickDuration =
+    std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(cfg::kFixedDt));
+
+void CaptureSnapshot(RenderSnapshot &snap, const Game &game) {
+  snap.player = game.player;
+  snap.previousPlayer = game.previousPlayer;
+  snap.particles = game.particles;
+  snap.activeEffects = game.activeEffects;
+  snap.activeEffectCount = game.activeEffectCount;
+  snap.hasShield = game.hasShield;
+  snap.ghostMode = game.ghostMode;
+  snap.speedBoostAmount = game.speedBoostAmount;
+  snap.speedDrainAmount = game.speedDrainAmount;
+  snap.scoreMultiplierBoost = game.scoreMultiplierBoost;
+  snap.obstacleRevealActive = game.obstacleRevealActive;
+
+  snap.runActive = game.runActive;
+  snap.runOver = game.runOver;
+  snap.levelComplete = game.levelComplete;
+  snap.deathCause = game.deathCause;
+  snap.runTime = game.runTime;
+  snap.distanceScore = game.distanceScore;
+  snap.styleScore = game.styleScore;
+  snap.scoreMultiplier = game.scoreMultiplier;
+  snap.bestScore = game.bestScore;
+  snap.difficultyT = game.difficultyT;
+  snap.diffSpeedBonus = game.diffSpeedBonus;
+  snap.hazardProbability = game.hazardProbability;
+  snap.throttle = game.throttle;
+  snap.simTicks = game.simTicks;
+
+  if (game.isEndlessMode) {
+    snap.endlessLevel = game.endlessGenerator.GetLevel();
+    snap.level = nullptr;
+  } else {
+    snap.level = game.level;
+  }
+}
+
+void ApplySnapshot(Game &game, const RenderSnapshot &snap, Level &levelStorage) {
+  game.player = snap.player;
+  game.previousPlayer = snap.previousPlayer;
+  game.particles = snap.particles;
+  game.activeEffects = snap.activeEffects;
+  game.activeEffectCount = snap.activeEffectCount;
+  game.hasShield = snap.hasShield;
+  game.ghostMode = snap.ghostMode;
+  game.speedBoostAmount = snap.speedBoostAmount;
+  game.speedDrainAmount = snap.speedDrainAmount;
+  game.scoreMultiplierBoost = snap.scoreMultiplierBoost;
+  game.obstacleRevealActive = snap.obstacleRevealActive;
+
+  game.runActive = snap.runActive;
+  game.runOver = snap.runOver;
+  game.levelComplete = snap.levelComplete;
+  game.deathCause = snap.deathCause;
+  game.runTime = snap.runTime;
+  game.distanceScore = snap.distanceScore;
+  game.styleScore = snap.styleScore;
+  game.scoreMultiplier = snap.scoreMultiplier;
+  game.bestScore = snap.bestScore;
+  game.difficultyT = snap.difficultyT;
+  game.diffSpeedBonus = snap.diffSpeedBonus;
+  game.hazardProbability = snap.hazardProbability;
+  game.throttle = snap.throttle;
+  game.simTicks = snap.simTicks;
+
+  if (game.isEndlessMode) {
+    levelStorage = snap.endlessLevel;
+    game.level = &levelStorage;
+  } else {
+    game.level = snap.level;
+  }
+}
+
+void PullInput(SimThread &sim, InputState &input) {
+  input.moveX = sim.moveX.load(std::memory_order_relaxed);
+  input.throttleDelta = sim.throttleDelta.load(std::memory_order_relaxed);
+  if (sim.jumpQueued.exchange(false, std::memory_order_acq_rel))
+    input.jumpQueued = true;
+  if (sim.dashQueued.exchange(false, std::memory_order_acq_rel))
+    input.dashQueued = true;
+}
+
+void SimThreadMain(SimThread &sim, Clock::time_point start) {
+  perf::AllocScope allocScope(perf::AllocTag::Sim);
+  Game &game = sim.state;
+  Clock::time_point nextTick = start + kTickDuration;
+  uint64_t clampCount = 0;
+
+  while (sim.running.load(std::memory_order_acquire)) {
+    std::this_thread::sleep_until(nextTick);
+
+    const auto batchStart = Clock::now();
+    int steps = 0;
+    Clock::time_point tickTime = nextTick - kTickDuration;
+    while (nextTick <= batchStart) {
+      if (steps == cfg::kMaxSimStepsPerFrame) {
+        // Too far behind: drop the backlog like the single-threaded loop.
+        nextTick = batchStart + kTickDuration;
+        ++clampCount;
+        break;
+      }
+      PullInput(sim, game.input);
+      game.previousPlayer = game.player;
+      if (game.runActive) {
+        SimStep(game, cfg::kFixedDt);
+      }
+      ++game.simTicks;
+      ++steps;
+      tickTime = nextTick;
+      nextTick += kTickDuration;
+    }
+    if (steps == 0)
+      continue;
+
+    RenderSnapshot &snap = sim.snapshots.WriteSlot();
+    CaptureSnapshot(snap, game);
+    snap.tickTime = tickTime;
+    snap.stepMs = std::chrono::duration<float, std::milli>(Clock::now() -
+                                                           batchStart)
+                      .count();
+    snap.clampCount = clampCount;
+    sim.snapshots.Publish();
+  }
+}
+
+} // namespace
+
+bool IsSimThreadRunning(const SimThread &sim) {
+  return sim.thread.joinable();
+}
+
+void StartSimThread(SimThread &sim, const Game &game) {
+  if (IsSimThreadRunning(sim))
+    return;
+
+  sim.state = game;
+  if (sim.state.isEndlessMode)
+    sim.state.level = &sim.state.endlessGenerator.GetLevel();
+  sim.state.input = {};
+
+  sim.moveX.store(0.0f, std::memory_order_relaxed);
+  sim.throttleDelta.store(0.0f, std::memory_order_relaxed);
+  sim.jumpQueued.store(false, std::memory_order_relaxed);
+  sim.dashQueued.store(false, std::memory_order_relaxed);
+
+  // Seed the buffer so the renderer has a snapshot before the first tick.
+  const Clock::time_point start = Clock::now();
+  sim.snapshots.Reset();
+  RenderSnapshot &snap = sim.snapshots.WriteSlot();
+  CaptureSnapshot(snap, sim.state);
+  snap.tickTime = start;
+  snap.stepMs = 0.0f;
+  snap.clampCount = 0;
+  sim.snapshots.Publish();
+  sim.lastAppliedTicks = sim.state.simTicks;
+  sim.lastClampCount = 0;
+
+  sim.running.store(true, std::memory_order_release);
+  sim.thread = std::thread(SimThreadMain, std::ref(sim), start);
+  LOG_INFO("Sim thread started at tick {}", game.simTicks);
+}
+
+void StopSimThread(SimThread &sim, Game &game) {
+  if (!IsSimThreadRunning(sim))
+    return;
+
+  sim.running.store(false, std::memory_order_release);
+  sim.thread.join();
+
+  // The thread is gone; its state is authoritative and safe to read.
+  RenderSnapshot finalState{};
+  CaptureSnapshot(finalState, sim.state);
+  ApplySnapshot(game, finalState, sim.renderLevel);
+  game.endlessGenerator = sim.state.endlessGenerator;
+  game.rngState = sim.state.rngState;
+  game.obstacleSurgePending = sim.state.obstacleSurgePending;
+  if (game.isEndlessMode)
+    game.level = &game.endlessGenerator.GetLevel();
+  game.accumulator = 0.0f;
+  LOG_INFO("Sim thread stopped at tick {}", game.simTicks);
+}
+
+void PushSimInput(SimThread &sim, InputState &input) {
+  sim.moveX.store(input.moveX, std::memory_order_relaxed);
+  sim.throttleDelta.store(input.throttleDelta, std::memory_order_relaxed);
+  if (input.jumpQueued)
+    sim.jumpQueued.store(true, std::memory_order_release);
+  if (input.dashQueued)
+    sim.dashQueued.store(true, std::memory_order_release);
+  input.jumpQueued = false;
+  input.dashQueued = false;
+}
+
+float SyncFromSimThread(SimThread &sim, Game &game, int &stepsOut,
+                        bool &clampedOut) {
+  stepsOut = 0;
+  clampedOut = false;
+
+  if (const RenderSnapshot *snap = sim.snapshots.ReadLatest()) {
+    ApplySnapshot(game, *snap, sim.renderLevel);
+    game.updateMs = snap->stepMs;
+    stepsOut = static_cast<int>(snap->simTicks - sim.lastAppliedTicks);
+    clampedOut = snap->clampCount != sim.lastClampCount;
+    sim.lastAppliedTicks = snap->simTicks;
+    sim.lastClampCount = snap->clampCount;
+  }
+
+  const float sinceTick = std::chrono::duration<float>(
+                              Clock::now() - sim.snapshots.Front().tickTime)
+                              .count();
+  return std::clamp(sinceTick / cfg::kFixedDt, 0.0f, 1.0f);
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "core/TripleBuffer.hpp"
+#include "game/Game.hpp"
+
+// Optional dedicated simulation thread (F6).
+//
+// While a run is playing, the sim thread owns a private copy of the Game and
+// steps it at cfg::kFixedDt. After each batch of ticks it publishes an
+// immutable RenderSnapshot through a lock-free triple buffer; the main thread
+// copies the newest one into its Game before rendering, so RenderFrame and
+// SimStep never touch the same memory. Input flows the other way through
+// atomics. Stopping the thread copies the final sim state back.
+
+// Sim-owned state that the renderer, HUD and screen logic read.
+struct RenderSnapshot {
+  PlayerSim player{};
+  PlayerSim previousPlayer{};
+  BurstParticles particles{};
+  std::array<ActiveEffect, 8> activeEffects{};
+  int activeEffectCount = 0;
+  bool hasShield = false;
+  bool ghostMode = false;
+  float speedBoostAmount = 0.0f;
+  float speedDrainAmount = 0.0f;
+  float scoreMultiplierBoost = 1.0f;
+  bool obstacleRevealActive = false;
+
+  bool runActive = true;
+  bool runOver = false;
+  bool levelComplete = false;
+  int deathCause = 0;
+  float runTime = 0.0f;
+  float distanceScore = 0.0f;
+  float styleScore = 0.0f;
+  float scoreMultiplier = 1.0f;
+  float bestScore = 0.0f;
+  float difficultyT = 0.0f;
+  float diffSpeedBonus = 0.0f;
+  float hazardProbability = 0.0f;
+  float throttle = 0.5f;
+  uint64_t simTicks = 0;
+
+  // Built-in levels are immutable statics and shared by pointer; the endless
+  // level keeps growing on the sim thread, so it is copied.
+  const Level *level = nullptr;
+  Level endlessLevel{};
+
+  // Sim clock time of `player` (the last tick's deadline), for interpolation.
+  std::chrono::steady_clock::time_point tickTime{};
+  float stepMs = 0.0f;      // Time spent stepping the last batch
+  uint64_t clampCount = 0;  // Batches that hit cfg::kMaxSimStepsPerFrame
+};
+
+struct SimThread {
+  std::thread thread;
+  std::atomic<bool> running{false};
+
+  Game state{}; // Owned by the sim thread while running
+  core::TripleBuffer<RenderSnapshot> snapshots{};
+
+  // Main -> sim input. One-shot actions are latched until the sim consumes them.
+  std::atomic<float> moveX{0.0f};
+  std::atomic<float> throttleDelta{0.0f};
+  std::atomic<bool> jumpQueued{false};
+  std::atomic<bool> dashQueued{false};
+
+  // Main-thread copy of the endless level from the last applied snapshot.
+  Level renderLevel{};
+  uint64_t lastAppliedTicks = 0;
+  uint64_t lastClampCount = 0;
+};
+
+bool IsSimThreadRunning(const SimThread &sim);
+
+// Copy the game's sim state to the thread and start stepping it.
+void StartSimThread(SimThread &sim, const Game &game);
+
+// Stop and join the thread, then copy the final sim state back into `game`.
+void StopSimThread(SimThread &sim, Game &game);
+
+// Forward this frame's input. Clears the one-shot flags in `input`.
+void PushSimInput(SimThread &sim, InputState &input);
+
+// Apply the newest published snapshot (if any) to `game`.
+// Returns the interpolation alpha derived from the snapshot's tick time.
+// `stepsOut`/`clampedOut` report ticks run since the previous sync.
+float SyncFromSimThread(SimThread &sim, Game &game, int &stepsOut,
+                        bool &clampedOut);
@@ -0,0 +1,282 @@
+#include "render/CubeBatch.hpp"
+
+#include <cmath>
+
+#include "core/Config.hpp"
+#include "core/Log.hpp"
+#include "raymath.h"
+#include "rlgl.h"
+
+namespace render {
+
+namespace {
+
+// ─── Shaders
+// ──────────────────────────────────────────────────────────────────
+
+const char *kCubeVs = R"(#version 330
+in vec3 vertexPosition;
+in vec2 vertexTexCoord;
+in vec4 instanceCenter; // xyz = centre, w = cos(yaw)
+in vec4 instanceSize;   // xyz = size,   w = sin(yaw)
+in vec4 instanceColor;
+uniform mat4 mvp;
+out vec2 fragTexCoord;
+out vec4 fragColor;
+void main() {
+  vec3 p = vertexPosition * instanceSize.xyz;
+  float c = instanceCenter.w;
+  float s = instanceSize.w;
+  p = vec3(c * p.x + s * p.z, p.y, -s * p.x + c * p.z);
+  fragTexCoord = vertexTexCoord;
+  fragColor = instanceColor;
+  gl_Position = mvp * vec4(p + instanceCenter.xyz, 1.0);
+}
+)";
+
+// Wire mode keeps a ~1 px band along each face's UV border, which traces the
+// same 12 edges DrawCubeWiresV draws.
+const char *kCubeFs = R"(#version 330
+in vec2 fragTexCoord;
+in vec4 fragColor;
+uniform int wireMode;
+out vec4 finalColor;
+void main() {
+  if (wireMode != 0) {
+    vec2 edge = min(fragTexCoord, 1.0 - fragTexCoord) / fwidth(fragTexCoord);
+    if (min(edge.x, edge.y) > 1.0) discard;
+  }
+  finalColor = fragColor;
+}
+)";
+
+// ─── Instance lists
+// ───────────────────────────────────────────────────────────
+
+struct CubeInstance {
+  float center[3];
+  float cosYaw;
+  float size[3];
+  float sinYaw;
+  Color color;
+};
+static_assert(sizeof(CubeInstance) == 36, "instance layout must stay packed");
+
+// Consecutive instances of one kind, drawn with one instanced call.
+struct InstanceRun {
+  int start = 0;
+  int count = 0;
+  bool wire = false;
+};
+
+// Instances in submission order. Solids and wires alternate in runs so
+// translucent cubes blend in the order they were queued.
+struct InstanceList {
+  CubeInstance items[cfg::kCubeBatchCapacity];
+  InstanceRun runs[cfg::kCubeBatchCapacity];
+  int count = 0;
+  int runCount = 0;
+  unsigned int vbo = 0;
+};
+
+bool g_ready = false;
+Mesh g_cubeMesh = {};
+Shader g_shader = {};
+int g_mvpLoc = -1;
+int g_wireModeLoc = -1;
+int g_centerAttrib = -1;
+int g_sizeAttrib = -1;
+int g_colorAttrib = -1;
+
+InstanceList g_cubes;
+CubeBatchStats g_stats;
+
+void DrawImmediate(const CubeInstance &inst, bool wire) {
+  const Vector3 size = {inst.size[0], inst.size[1], inst.size[2]};
+  rlPushMatrix();
+  rlTranslatef(inst.center[0], inst.center[1], inst.center[2]);
+  if (inst.cosYaw != 1.0f)
+    rlRotatef(std::atan2(inst.sinYaw, inst.cosYaw) * RAD2DEG, 0.0f, 1.0f,
+              0.0f);
+  if (wire)
+    DrawCubeWiresV({0.0f, 0.0f, 0.0f}, size, inst.color);
+  else
+    DrawCubeV({0.0f, 0.0f, 0.0f}, size, inst.color);
+  rlPopMatrix();
+  ++g_stats.immediateCubes;
+}
+
+void DrawList(InstanceList &list) {
+  if (list.count == 0)
+    return;
+
+  const int stride = static_cast<int>(sizeof(CubeInstance));
+  rlUpdateVertexBuffer(list.vbo, list.items, list.count * stride, 0);
+
+  rlEnableShader(g_shader.id);
+  rlSetUniformMatrix(g_mvpLoc, MatrixMultiply(rlGetMatrixModelview(),
+                                              rlGetMatrixProjection()));
+  rlEnableVertexArray(g_cubeMesh.vaoId);
+  rlEnableVertexBuffer(list.vbo);
+
+  for (int r = 0; r < list.runCount; ++r) {
+    const InstanceRun &run = list.runs[r];
+    const int wireMode = run.wire ? 1 : 0;
+    rlSetUniform(g_wireModeLoc, &wireMode, SHADER_UNIFORM_INT, 1);
+    // Point the instance attributes at this run's first instance.
+    const int base = run.start * stride;
+    rlSetVertexAttribute(g_centerAttrib, 4, RL_FLOAT, false, stride, base);
+    rlSetVertexAttribute(g_sizeAttrib, 4, RL_FLOAT, false, stride, base + 16);
+    rlSetVertexAttribute(g_colorAttrib, 4, RL_UNSIGNED_BYTE, true, stride,
+                         base + 32);
+
+    // Wireframes show their back edges, like DrawCubeWiresV.
+    if (run.wire)
+      rlDisableBackfaceCulling();
+    rlDrawVertexArrayElementsInstanced(0, g_cubeMesh.triangleCount * 3,
+                                       nullptr, run.count);
+    if (run.wire)
+      rlEnableBackfaceCulling();
+    ++g_stats.drawCalls;
+  }
+
+  rlDisableVertexBuffer();
+  rlDisableVertexArray();
+  rlDisableShader();
+
+  list.count = 0;
+  list.runCount = 0;
+}
+
+void Push(Vector3 center, Vector3 size, float cosYaw, float sinYaw,
+          Color color, bool wire) {
+  CubeInstance inst = {{center.x, center.y, center.z},
+                       cosYaw,
+                       {size.x, size.y, size.z},
+                       sinYaw,
+                       color};
+  if (wire)
+    ++g_stats.wireCubes;
+  else
+    ++g_stats.solidCubes;
+
+  if (!g_ready) {
+    DrawImmediate(inst, wire);
+    return;
+  }
+  InstanceList &list = g_cubes;
+  if (list.count == cfg::kCubeBatchCapacity)
+    FlushCubeBatch();
+  if (list.runCount == 0 || list.runs[list.runCount - 1].wire != wire)
+    list.runs[list.runCount++] = {list.count, 0, wire};
+  ++list.runs[list.runCount - 1].count;
+  list.items[list.count++] = inst;
+}
+
+Vector3 ToWorld(const CubeFrame &frame, Vector3 local) {
+  return {frame.origin.x + frame.cosYaw * local.x + frame.sinYaw * local.z,
+          frame.origin.y + local.y,
+          frame.origin.z - frame.sinYaw * local.x + frame.cosYaw * local.z};
+}
+
+} // namespace
+
+CubeFrame MakeCubeFrame(Vector3 origin, float yawDeg) {
+  const float rad = yawDeg * DEG2RAD;
+  return {origin, std::cos(rad), std::sin(rad)};
+}
+
+void InitCubeBatch() {
+  if (g_ready)
+    return;
+
+  g_shader = LoadShaderFromMemory(kCubeVs, kCubeFs);
+  if (g_shader.id == 0 || g_shader.id == rlGetShaderIdDefault()) {
+    LOG_WARN("Cube batch: instancing shader unavailable, using immediate mode");
+    return;
+  }
+  g_mvpLoc = GetShaderLocation(g_shader, "mvp");
+  g_wireModeLoc = GetShaderLocation(g_shader, "wireMode");
+  g_centerAttrib = GetShaderLocationAttrib(g_shader, "instanceCenter");
+  g_sizeAttrib = GetShaderLocationAttrib(g_shader, "instanceSize");
+  g_colorAttrib = GetShaderLocationAttrib(g_shader, "instanceColor");
+
+  g_cubeMesh = GenMeshCube(1.0f, 1.0f, 1.0f);
+  if (g_cubeMesh.vaoId == 0 || g_centerAttrib < 0 || g_sizeAttrib < 0 ||
+      g_colorAttrib < 0) {
+    LOG_WARN("Cube batch: no vertex array support, using immediate mode");
+    UnloadMesh(g_cubeMesh);
+    UnloadShader(g_shader);
+    g_cubeMesh = {};
+    g_shader = {};
+    return;
+  }
+
+  const int bytes =
+      static_cast<int>(sizeof(CubeInstance)) * cfg::kCubeBatchCapacity;
+  g_cubes.vbo = rlLoadVertexBuffer(nullptr, bytes, true);
+
+  // Instance attributes live in the cube mesh's VAO; their offsets into the
+  // instance buffer are set per draw.
+  rlEnableVertexArray(g_cubeMesh.vaoId);
+  rlEnableVertexBuffer(g_cubes.vbo);
+  const int attribs[3] = {g_centerAttrib, g_sizeAttrib, g_colorAttrib};
+  for (int attrib : attribs) {
+    rlEnableVertexAttribute(attrib);
+    rlSetVertexAttributeDivisor(attrib, 1);
+  }
+  rlDisableVertexBuffer();
+  rlDisableVertexArray();
+
+  g_ready = true;
+  LOG_INFO("Cube batch ready ({} instances per flush)",
+           cfg::kCubeBatchCapacity);
+}
+
+void CleanupCubeBatch() {
+  if (!g_ready)
+    return;
+  rlUnloadVertexBuffer(g_cubes.vbo);
+  UnloadMesh(g_cubeMesh);
+  UnloadShader(g_shader);
+  g_cubes.count = 0;
+  g_cubes.runCount = 0;
+  g_cubes.vbo = 0;
+  g_cubeMesh = {};
+  g_shader = {};
+  g_ready = false;
+}
+
+void BatchCube(Vector3 position, Vector3 size, Color color) {
+  Push(position, size, 1.0f, 0.0f, color, false);
+}
+
+void BatchCubeWires(Vector3 position, Vector3 size, Color color) {
+  Push(position, size, 1.0f, 0.0f, color, true);
+}
+
+void BatchCube(const CubeFrame &frame, Vector3 position, Vector3 size,
+               Color color) {
+  Push(ToWorld(frame, position), size, frame.cosYaw, frame.sinYaw, color,
+       false);
+}
+
+void BatchCubeWires(const CubeFrame &frame, Vector3 position, Vector3 size,
+                    Color color) {
+  Push(ToWorld(frame, position), size, frame.cosYaw, frame.sinYaw, color,
+       true);
+}
+
+void FlushCubeBatch() {
+  if (!g_ready || g_cubes.count == 0)
+    return;
+  // Emit pending immediate-mode geometry first so draw order is preserved.
+  rlDrawRenderBatchActive();
+  DrawList(g_cubes);
+}
+
+void ResetCubeBatchStats() { g_stats = {}; }
+
+const CubeBatchStats &GetCubeBatchStats() { return g_stats; }
+
+} // namespace render
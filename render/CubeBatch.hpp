@@ -0,0 +1,57 @@
+#pragma once
+
+#include <raylib.h>
+
+// Instanced cube renderer.
+//
+// Replaces per-cube DrawCubeV/DrawCubeWiresV immediate-mode calls: cubes are
+// queued into a fixed-size instance list (centre, size, yaw, colour) and drawn
+// in submission order when flushed, with one instanced call per run of
+// consecutive solids or wires. Wireframes use the same cube mesh with a
+// fragment shader that keeps only the face edges.
+//
+// Flush at pass boundaries so ordering against immediate-mode draws (lines,
+// billboards, models) stays the same as before. If the instancing shader is
+// unavailable every call falls back to the immediate-mode path.
+
+namespace render {
+
+// Local frame for cubes drawn relative to a parent: origin plus a yaw about
+// +Y, matching rlTranslatef(origin) followed by rlRotatef(yawDeg, 0, 1, 0).
+struct CubeFrame {
+  Vector3 origin = {};
+  float cosYaw = 1.0f;
+  float sinYaw = 0.0f;
+};
+
+CubeFrame MakeCubeFrame(Vector3 origin, float yawDeg);
+
+struct CubeBatchStats {
+  int drawCalls = 0;      // Instanced draws issued
+  int solidCubes = 0;     // Solid instances submitted
+  int wireCubes = 0;      // Wireframe instances submitted
+  int immediateCubes = 0; // Cubes drawn through the fallback path
+};
+
+// Needs a GL context. Safe to call more than once.
+void InitCubeBatch();
+void CleanupCubeBatch();
+
+// Drop-in replacements for DrawCubeV / DrawCubeWiresV.
+void BatchCube(Vector3 position, Vector3 size, Color color);
+void BatchCubeWires(Vector3 position, Vector3 size, Color color);
+
+// Same, with `position` in `frame`'s local space.
+void BatchCube(const CubeFrame &frame, Vector3 position, Vector3 size,
+               Color color);
+void BatchCubeWires(const CubeFrame &frame, Vector3 position, Vector3 size,
+                    Color color);
+
+// Draw everything queued so far, in the order it was queued.
+void FlushCubeBatch();
+
+// Per-frame counters. Reset at the start of RenderFrame.
+void ResetCubeBatchStats();
+const CubeBatchStats &GetCubeBatchStats();
+
+} // namespace render
@@ -0,0 +1,273 @@
+#include "render/DrawStats.hpp"
+
+#include "render/CubeBatch.hpp"
+#include "rlgl.h"
+
+#if SKYROADS_GL_DRAW_HOOKS
+// glad's entry points, defined inside raylib's rlgl implementation. Only
+// the pointers' names and signatures matter here, not glad's header.
+#if defined(_WIN32)
+#define SKYROADS_GL_APIENTRY __stdcall
+#else
+#define SKYROADS_GL_APIENTRY
+#endif
+
+using GlDrawArraysFn = void(SKYROADS_GL_APIENTRY *)(unsigned int mode,
+                                                    int first, int count);
+using GlDrawElementsFn = void(SKYROADS_GL_APIENTRY *)(unsigned int mode,
+                                                      int count,
+                                                      unsigned int type,
+                                                      const void *indices);
+using GlDrawArraysInstancedFn = void(SKYROADS_GL_APIENTRY *)(
+    unsigned int mode, int first, int count, int instances);
+using GlDrawElementsInstancedFn = void(SKYROADS_GL_APIENTRY *)(
+    unsigned int mode, int count, unsigned int type, const void *indices,
+    int instances);
+using GlBindFn = void(SKYROADS_GL_APIENTRY *)(unsigned int id);
+using GlBindTextureFn = void(SKYROADS_GL_APIENTRY *)(unsigned int target,
+                                                     unsigned int texture);
+
+extern "C" {
+extern GlDrawArraysFn glad_glDrawArrays;
+extern GlDrawElementsFn glad_glDrawElements;
+extern GlDrawArraysInstancedFn glad_glDrawArraysInstanced;
+extern GlDrawElementsInstancedFn glad_glDrawElementsInstanced;
+extern GlBindFn glad_glUseProgram;
+extern GlBindFn glad_glBindVertexArray;
+extern GlBindTextureFn glad_glBindTexture;
+}
+#endif
+
+namespace render {
+
+namespace {
+
+DrawStats g_frame; // Being collected
+DrawStats g_last;  // Last completed frame
+int g_pass = 0;
+bool g_enabled = false;
+bool g_available = false;
+rlRenderBatch g_batch = {};
+bool g_batchBound = false;   // rlgl's batch vertex array is bound
+bool g_flushCounted = false; // A draw since that bind counted the flush
+
+#if SKYROADS_GL_DRAW_HOOKS
+bool IsBatchVertexArray(unsigned int id) {
+  if (id == 0 || !g_available)
+    return false;
+  for (int i = 0; i < g_batch.bufferCount; ++i) {
+    if (g_batch.vertexBuffer[i].vaoId == id)
+      return true;
+  }
+  return false;
+}
+
+struct GlEntryPoints {
+  GlDrawArraysFn drawArrays = nullptr;
+  GlDrawElementsFn drawElements = nullptr;
+  GlDrawArraysInstancedFn drawArraysInstanced = nullptr;
+  GlDrawElementsInstancedFn drawElementsInstanced = nullptr;
+  GlBindFn useProgram = nullptr;
+  GlBindFn bindVertexArray = nullptr;
+  GlBindTextureFn bindTexture = nullptr;
+};
+
+GlEntryPoints g_gl; // The real entry points while hooked
+
+void SKYROADS_GL_APIENTRY HookDrawArrays(unsigned int mode, int first,
+                                         int count) {
+  OnGlDraw(count);
+  g_gl.drawArrays(mode, first, count);
+}
+
+void SKYROADS_GL_APIENTRY HookDrawElements(unsigned int mode, int count,
+                                           unsigned int type,
+                                           const void *indices) {
+  OnGlDraw(count);
+  g_gl.drawElements(mode, count, type, indices);
+}
+
+void SKYROADS_GL_APIENTRY HookDrawArraysInstanced(unsigned int mode,
+                                                  int first, int count,
+                                                  int instances) {
+  OnGlDraw(count * instances);
+  g_gl.drawArraysInstanced(mode, first, count, instances);
+}
+
+void SKYROADS_GL_APIENTRY HookDrawElementsInstanced(unsigned int mode,
+                                                    int count,
+                                                    unsigned int type,
+                                                    const void *indices,
+                                                    int instances) {
+  OnGlDraw(count * instances);
+  g_gl.drawElementsInstanced(mode, count, type, indices, instances);
+}
+
+void SKYROADS_GL_APIENTRY HookUseProgram(unsigned int program) {
+  CountStateChange();
+  g_gl.useProgram(program);
+}
+
+void SKYROADS_GL_APIENTRY HookBindVertexArray(unsigned int array) {
+  OnGlBindVertexArray(IsBatchVertexArray(array));
+  g_gl.bindVertexArray(array);
+}
+
+void SKYROADS_GL_APIENTRY HookBindTexture(unsigned int target,
+                                          unsigned int texture) {
+  CountStateChange();
+  g_gl.bindTexture(target, texture);
+}
+
+bool InstallHooks() {
+  // Null until the context exists, and on builds without these entry points.
+  if (!glad_glDrawArrays || !glad_glDrawElements ||
+      !glad_glDrawArraysInstanced || !glad_glDrawElementsInstanced ||
+      !glad_glUseProgram || !glad_glBindVertexArray || !glad_glBindTexture)
+    return false;
+  g_gl = {glad_glDrawArrays,          glad_glDrawElements,
+          glad_glDrawArraysInstanced, glad_glDrawElementsInstanced,
+          glad_glUseProgram,          glad_glBindVertexArray,
+          glad_glBindTexture};
+  glad_glDrawArrays = HookDrawArrays;
+  glad_glDrawElements = HookDrawElements;
+  glad_glDrawArraysInstanced = HookDrawArraysInstanced;
+  glad_glDrawElementsInstanced = HookDrawElementsInstanced;
+  glad_glUseProgram = HookUseProgram;
+  glad_glBindVertexArray = HookBindVertexArray;
+  glad_glBindTexture = HookBindTexture;
+  return true;
+}
+
+void RemoveHooks() {
+  glad_glDrawArrays = g_gl.drawArrays;
+  glad_glDrawElements = g_gl.drawElements;
+  glad_glDrawArraysInstanced = g_gl.drawArraysInstanced;
+  glad_glDrawElementsInstanced = g_gl.drawElementsInstanced;
+  glad_glUseProgram = g_gl.useProgram;
+  glad_glBindVertexArray = g_gl.bindVertexArray;
+  glad_glBindTexture = g_gl.bindTexture;
+  g_gl = {};
+}
+#else
+bool InstallHooks() { return false; }
+void RemoveHooks() {}
+#endif
+
+PassDrawStats &CurrentPass() { return g_frame.passes[g_pass]; }
+
+} // namespace
+
+const char *DrawPassName(DrawPass pass) {
+  switch (pass) {
+  case DrawPass::Space:
+    return "Space";
+  case DrawPass::Mountains:
+    return "Mountains";
+  case DrawPass::Level:
+    return "Level";
+  case DrawPass::Obstacles:
+    return "Obstacles";
+  case DrawPass::PowerUps:
+    return "Power-ups";
+  case DrawPass::Player:
+    return "Player";
+  case DrawPass::Particles:
+    return "Particles";
+  case DrawPass::Hud:
+    return "HUD";
+  }
+  return "?";
+}
+
+void InitDrawStats() {
+  if (g_available || !InstallHooks())
+    return;
+  // Same shape as rlgl's default batch; owning it lets the hooks tell its
+  // flushes apart from other vertex array binds.
+  g_batch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS,
+                              RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+  rlSetRenderBatchActive(&g_batch);
+  g_available = true;
+}
+
+void ShutdownDrawStats() {
+  if (!g_available)
+    return;
+  rlSetRenderBatchActive(nullptr);
+  rlUnloadRenderBatch(g_batch);
+  g_batch = {};
+  g_available = false;
+  RemoveHooks();
+}
+
+bool DrawStatsAvailable() { return g_available; }
+
+void SetDrawStatsEnabled(bool enabled) { g_enabled = enabled; }
+
+bool DrawStatsEnabled() { return g_enabled; }
+
+void BeginDrawStatsFrame() {
+  g_frame = {};
+  g_pass = 0;
+}
+
+void SetDrawPass(DrawPass pass) {
+  if (!g_enabled)
+    return;
+  FlushCubeBatch();
+  rlDrawRenderBatchActive();
+  g_pass = static_cast<int>(pass);
+}
+
+void EndDrawStatsFrame() {
+  if (!g_enabled)
+    return;
+  PassDrawStats total;
+  for (const PassDrawStats &p : g_frame.passes) {
+    total.drawCalls += p.drawCalls;
+    total.batchFlushes += p.batchFlushes;
+    total.vertices += p.vertices;
+    total.stateChanges += p.stateChanges;
+  }
+  g_frame.total = total;
+  g_last = g_frame;
+}
+
+const DrawStats &GetDrawStats() { return g_last; }
+
+void CountDrawCall(int vertices) {
+  if (!g_enabled)
+    return;
+  ++CurrentPass().drawCalls;
+  CurrentPass().vertices += vertices;
+}
+
+void CountBatchFlush() {
+  if (g_enabled)
+    ++CurrentPass().batchFlushes;
+}
+
+void CountStateChange() {
+  if (g_enabled)
+    ++CurrentPass().stateChanges;
+}
+
+// rlDrawRenderBatch binds the batch's vertex array twice per flush, once to
+// upload the vertices and once to draw them, so a flush is counted on the
+// first draw after a bind rather than on the bind itself.
+void OnGlDraw(int vertices) {
+  if (g_batchBound && !g_flushCounted) {
+    CountBatchFlush();
+    g_flushCounted = true;
+  }
+  CountDrawCall(vertices);
+}
+
+void OnGlBindVertexArray(bool batchArray) {
+  g_batchBound = batchArray;
+  g_flushCounted = false;
+  CountStateChange();
+}
+
+} // namespace render
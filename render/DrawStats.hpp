@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+
+// Per-pass GPU submission counters.
+//
+// rlgl reaches OpenGL through glad's function pointers; InitDrawStats swaps
+// the draw, program, texture and vertex array entry points for counting
+// wrappers (desktop GL builds with SKYROADS_GL_DRAW_HOOKS). Every draw then
+// counts, whether it comes from rlgl's immediate-mode batch, the cube
+// batch, prefabs or level meshes. The renderer also runs on a render batch
+// of its own, so a draw with that batch's vertex array bound marks an rlgl
+// flush.
+//
+// RenderFrame tags its passes with SetDrawPass. While stats are enabled a
+// pass switch flushes the cube batch and the rlgl batch, so queued work is
+// charged to the pass that queued it; the extra flushes show up in the
+// counts. Disabled, SetDrawPass does nothing.
+
+namespace render {
+
+enum class DrawPass : uint8_t {
+  Space, // Backdrop, space objects, scene dressing
+  Mountains,
+  Level, // Track, gates, bands and streaks
+  Obstacles,
+  PowerUps,
+  Player,
+  Particles,
+  Hud, // Everything 2D, including the frame blit
+};
+constexpr int kDrawPassCount = 8;
+
+const char *DrawPassName(DrawPass pass);
+
+struct PassDrawStats {
+  int drawCalls = 0;
+  int batchFlushes = 0; // rlgl render batch submissions
+  int vertices = 0;     // Indices or vertices, times instances
+  int stateChanges = 0; // Program, texture and vertex array binds
+};
+
+struct DrawStats {
+  PassDrawStats passes[kDrawPassCount];
+  PassDrawStats total;
+};
+
+// Needs a GL context. Installs the hooks and the renderer's render batch;
+// without hooks the counters stay at zero.
+void InitDrawStats();
+void ShutdownDrawStats();
+bool DrawStatsAvailable();
+
+void SetDrawStatsEnabled(bool enabled);
+bool DrawStatsEnabled();
+
+// Frame bracket around everything RenderFrame submits. EndDrawStatsFrame
+// publishes the frame to GetDrawStats.
+void BeginDrawStatsFrame();
+void SetDrawPass(DrawPass pass);
+void EndDrawStatsFrame();
+
+// Last completed frame.
+const DrawStats &GetDrawStats();
+
+// Counters the GL hooks feed into the current pass. Exposed for tests.
+void CountDrawCall(int vertices);
+void CountBatchFlush();
+void CountStateChange();
+
+// What the draw and vertex array hooks report, without the GL call.
+// `batchArray`: the vertex array bound is the renderer's render batch.
+void OnGlDraw(int vertices);
+void OnGlBindVertexArray(bool batchArray);
+
+} // namespace render
@@ -0,0 +1,245 @@
+#include "render/EndlessMesh.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "core/Config.hpp"
+#include "core/PerfTracker.hpp"
+#include "render/LevelMesh.hpp"
+#include "render/Palette.hpp"
+#include "sim/Level.hpp"
+
+namespace render {
+
+namespace {
+
+struct MeshJob {
+  uint32_t generation = 0;
+  float lastStartZ = 0.0f; // Of the job's last segment
+  std::vector<LevelSegment> segments;
+  LevelPalette pal{};
+};
+
+struct MeshResult {
+  uint32_t generation = 0;
+  float lastStartZ = 0.0f;
+  MeshBuilder builder;
+};
+
+struct EndlessChunk {
+  Model model = {};
+  float minZ = 0.0f;
+  float maxZ = 0.0f;
+};
+
+struct Mesher {
+  // Shared with the worker, guarded by `mutex`.
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::deque<MeshJob> jobs;
+  std::deque<MeshResult> results;
+  bool stopping = false;
+
+  // Main thread only.
+  std::thread worker;
+  uint32_t generation = 0;          // Bumped on reset; stale results dropped
+  int paletteIndex = -1;
+  int submittedEnd = 0;             // Segments handed to the worker
+  float lastSubmittedStartZ = 0.0f; // Finds them again after a shift
+  bool meshedAny = false;
+  float lastMeshedStartZ = 0.0f; // Of the last segment with an uploaded mesh
+  std::deque<EndlessChunk> chunks;
+  EndlessMeshStats stats;
+};
+
+Mesher g_mesher;
+
+void WorkerMain() {
+  perf::AllocScope allocScope(perf::AllocTag::Render);
+  std::unique_lock<std::mutex> lock(g_mesher.mutex);
+  for (;;) {
+    g_mesher.wake.wait(
+        lock, [] { return g_mesher.stopping || !g_mesher.jobs.empty(); });
+    if (g_mesher.stopping)
+      return;
+    MeshJob job = std::move(g_mesher.jobs.front());
+    g_mesher.jobs.pop_front();
+    lock.unlock();
+
+    MeshResult result;
+    result.generation = job.generation;
+    result.lastStartZ = job.lastStartZ;
+    for (const LevelSegment &seg : job.segments) {
+      AppendSegmentGeometry(result.builder, seg, GetSegmentStyle(seg, job.pal),
+                            job.pal);
+    }
+
+    lock.lock();
+    g_mesher.results.push_back(std::move(result));
+  }
+}
+
+void EnsureWorker() {
+  if (g_mesher.worker.joinable())
+    return;
+  g_mesher.stopping = false;
+  g_mesher.worker = std::thread(WorkerMain);
+}
+
+void UnloadChunks() {
+  for (EndlessChunk &chunk : g_mesher.chunks) {
+    if (chunk.model.meshCount > 0)
+      UnloadModel(chunk.model);
+  }
+  g_mesher.chunks.clear();
+}
+
+} // namespace
+
+void ResetEndlessMesh() {
+  if (g_mesher.submittedEnd == 0 && g_mesher.chunks.empty())
+    return;
+  {
+    std::lock_guard<std::mutex> lock(g_mesher.mutex);
+    g_mesher.jobs.clear();
+    g_mesher.results.clear();
+  }
+  ++g_mesher.generation;
+  UnloadChunks();
+  g_mesher.submittedEnd = 0;
+  g_mesher.lastSubmittedStartZ = 0.0f;
+  g_mesher.meshedAny = false;
+  g_mesher.lastMeshedStartZ = 0.0f;
+  g_mesher.stats = {};
+}
+
+int UpdateEndlessMesh(const Level &level, const LevelPalette &pal,
+                      int paletteIndex, float viewZ) {
+  if (!IsWindowReady())
+    return 0;
+  EnsureWorker();
+
+  Mesher &m = g_mesher;
+  EndlessMeshStats &stats = m.stats;
+
+  // Find the last submitted segment again: the generator drops segments
+  // from the front of the level, shifting the rest down. A restarted run no
+  // longer has it, and that or a palette switch invalidates everything
+  // meshed so far.
+  int lastSubmitted = -1;
+  for (int i = std::min(m.submittedEnd, level.segmentCount) - 1; i >= 0; --i) {
+    if (level.segments[i].startZ <= m.lastSubmittedStartZ) {
+      if (level.segments[i].startZ == m.lastSubmittedStartZ)
+        lastSubmitted = i;
+      break;
+    }
+  }
+  const bool regenerated = m.submittedEnd > 0 && lastSubmitted < 0;
+  if (regenerated || paletteIndex != m.paletteIndex) {
+    ResetEndlessMesh();
+    m.paletteIndex = paletteIndex;
+  } else {
+    m.submittedEnd = lastSubmitted + 1;
+  }
+
+  // Hand newly generated segments to the worker as one chunk.
+  if (level.segmentCount > m.submittedEnd) {
+    MeshJob job;
+    job.generation = m.generation;
+    job.lastStartZ = level.segments[level.segmentCount - 1].startZ;
+    job.segments.assign(level.segments + m.submittedEnd,
+                        level.segments + level.segmentCount);
+    job.pal = pal;
+    {
+      std::lock_guard<std::mutex> lock(m.mutex);
+      m.jobs.push_back(std::move(job));
+    }
+    m.wake.notify_one();
+    m.submittedEnd = level.segmentCount;
+    m.lastSubmittedStartZ = level.segments[m.submittedEnd - 1].startZ;
+    ++stats.pendingChunks;
+  }
+
+  // Upload finished meshes in order until the frame budget is spent. At
+  // least one upload per frame so a slow driver still makes progress.
+  using Clock = std::chrono::steady_clock;
+  const auto start = Clock::now();
+  stats.uploadedChunks = 0;
+  for (;;) {
+    MeshResult result;
+    {
+      std::lock_guard<std::mutex> lock(m.mutex);
+      if (m.results.empty())
+        break;
+      result = std::move(m.results.front());
+      m.results.pop_front();
+    }
+    if (result.generation != m.generation)
+      continue;
+
+    EndlessChunk chunk;
+    chunk.minZ = result.builder.minZ;
+    chunk.maxZ = result.builder.maxZ;
+    chunk.model = UploadMeshBuilder(result.builder);
+    m.chunks.push_back(chunk);
+    m.meshedAny = true;
+    m.lastMeshedStartZ = result.lastStartZ;
+    --stats.pendingChunks;
+    ++stats.uploadedChunks;
+
+    const float elapsedMs =
+        std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+    if (elapsedMs >= cfg::kMeshUploadBudgetMs)
+      break;
+  }
+  stats.uploadMs =
+      std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+
+  // The player only moves forward, so chunks behind the draw range are done.
+  while (!m.chunks.empty() &&
+         m.chunks.front().maxZ < viewZ - cfg::kLevelDrawDistance) {
+    if (m.chunks.front().model.meshCount > 0)
+      UnloadModel(m.chunks.front().model);
+    m.chunks.pop_front();
+    ++stats.retiredChunks;
+  }
+  stats.liveChunks = static_cast<int>(m.chunks.size());
+
+  // Meshes are uploaded in Z order, so the meshed segments are a prefix.
+  stats.meshedSegments = 0;
+  while (m.meshedAny && stats.meshedSegments < level.segmentCount &&
+         level.segments[stats.meshedSegments].startZ <= m.lastMeshedStartZ)
+    ++stats.meshedSegments;
+  return stats.meshedSegments;
+}
+
+void DrawEndlessMesh(float viewZ, float drawDistance) {
+  for (const EndlessChunk &chunk : g_mesher.chunks) {
+    if (chunk.maxZ < viewZ - drawDistance || chunk.minZ > viewZ + drawDistance)
+      continue;
+    DrawModel(chunk.model, {0.0f, 0.0f, 0.0f}, 1.0f, WHITE);
+  }
+}
+
+void ShutdownEndlessMesh() {
+  if (g_mesher.worker.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(g_mesher.mutex);
+      g_mesher.stopping = true;
+    }
+    g_mesher.wake.notify_one();
+    g_mesher.worker.join();
+  }
+  ResetEndlessMesh();
+  g_mesher.paletteIndex = -1;
+}
+
+const EndlessMeshStats &GetEndlessMeshStats() { return g_mesher.stats; }
+
+} // namespace render
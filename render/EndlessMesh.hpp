@@ -0,0 +1,44 @@
+#pragma once
+
+struct Level;
+struct LevelPalette;
+
+// Incremental static meshes for the endless level.
+//
+// The endless level appends segments and drops old ones from the front, so
+// each batch of new segments is handed to a worker thread that builds CPU vertex buffers
+// (render/LevelMesh's MeshBuilder). The main thread uploads finished
+// buffers within cfg::kMeshUploadBudgetMs per frame and frees chunks once
+// they fall behind the player, so the number of live chunks stays flat no
+// matter how long the run lasts. Segments whose mesh is still in flight
+// keep drawing through the cube batch.
+
+namespace render {
+
+struct EndlessMeshStats {
+  int liveChunks = 0;
+  int pendingChunks = 0;  // Queued or built, not uploaded yet
+  int uploadedChunks = 0; // This frame
+  int retiredChunks = 0;  // Since the last reset
+  int meshedSegments = 0; // Leading segments covered by uploaded chunks
+  float uploadMs = 0.0f;  // This frame
+};
+
+// Main thread, once per frame while an endless level is shown. Queues new
+// segments, uploads finished meshes and retires chunks behind `viewZ`.
+// Returns how many leading segments are covered by uploaded chunks.
+int UpdateEndlessMesh(const Level &level, const LevelPalette &pal,
+                      int paletteIndex, float viewZ);
+
+// Draw live chunks overlapping [viewZ - drawDistance, viewZ + drawDistance].
+void DrawEndlessMesh(float viewZ, float drawDistance);
+
+// Free every chunk and drop queued work. No-op if nothing is live.
+void ResetEndlessMesh();
+
+// Stop the worker thread and free everything. Renderer shutdown only.
+void ShutdownEndlessMesh();
+
+const EndlessMeshStats &GetEndlessMeshStats();
+
+} // namespace render
@@ -0,0 +1,278 @@
+#include "render/FrameRecorder.hpp"
+
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+#include "core/Config.hpp"
+#include "render/FrameTarget.hpp"
+#include "render/ReadbackQueue.hpp"
+
+namespace render {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// When the frame in the queue slot of the same index was captured; filled
+// before the slot is submitted.
+struct FrameStamp {
+  uint64_t simTick = 0;
+  double simMs = 0.0;
+  double wallMs = 0.0;
+};
+
+struct Recorder {
+  ReadbackQueue queue{cfg::kFrameRecorderSlots};
+  FrameStamp stamps[cfg::kFrameRecorderSlots];
+
+  // Set before the writer starts; read-only while it runs.
+  std::FILE *stream = nullptr;
+  std::FILE *timestamps = nullptr;
+  bool piped = false;
+  VideoFormat format = VideoFormat::Y4m;
+  int width = 0;
+  int height = 0;
+
+  // Writer thread only.
+  std::vector<unsigned char> converted;
+  int frameIndex = 0;
+  bool writeFailed = false;
+
+  // Main thread only.
+  int framesCaptured = 0;
+  int framesSkipped = 0; // Wrong frame size
+  bool haveFirstFrame = false;
+  uint64_t firstTick = 0;
+  Clock::time_point firstTime;
+};
+
+Recorder g_rec;
+
+std::FILE *OpenStream(const std::string &path, bool &piped) {
+  piped = !path.empty() && path[0] == '|';
+  if (!piped)
+    return std::fopen(path.c_str(), "wb");
+#if defined(_WIN32)
+  return _popen(path.c_str() + 1, "wb");
+#else
+  // An encoder that exits early would otherwise kill the process on the next
+  // write; ignored, fwrite fails with EPIPE and the writer drops the rest.
+  std::signal(SIGPIPE, SIG_IGN);
+  return popen(path.c_str() + 1, "w");
+#endif
+}
+
+void CloseStream(std::FILE *stream, bool piped) {
+  if (!piped) {
+    std::fclose(stream);
+    return;
+  }
+#if defined(_WIN32)
+  _pclose(stream);
+#else
+  pclose(stream);
+#endif
+}
+
+bool WriteFrame(int index) {
+  Recorder &r = g_rec;
+  if (r.writeFailed)
+    return false;
+
+  ReadbackSlot &slot = r.queue.slots[index];
+  const FrameStamp &stamp = r.stamps[index];
+  bool ok = false;
+  if (r.format == VideoFormat::Y4m) {
+    ConvertRgbaToYuv420(slot.pixels.data(), r.width, r.height,
+                        r.converted.data());
+    ok = std::fputs("FRAME\n", r.stream) >= 0 &&
+         std::fwrite(r.converted.data(), 1, r.converted.size(), r.stream) ==
+             r.converted.size();
+  } else {
+    const size_t size = static_cast<size_t>(r.width) * r.height * 3;
+    PackRgb(slot.pixels.data(), r.width * r.height);
+    ok = std::fwrite(slot.pixels.data(), 1, size, r.stream) == size;
+  }
+  if (ok && r.timestamps) {
+    std::fprintf(r.timestamps, "%d,%llu,%.3f,%.3f\n", r.frameIndex,
+                 static_cast<unsigned long long>(stamp.simTick), stamp.simMs,
+                 stamp.wallMs);
+  }
+  ++r.frameIndex;
+  // A closed pipe or full disk won't recover; drop the rest.
+  r.writeFailed = !ok;
+  return ok;
+}
+
+} // namespace
+
+bool StartRecording(const RecorderConfig &config) {
+  if (IsRecording())
+    return false;
+  int width = 0;
+  int height = 0;
+  GetFrameSize(width, height);
+  if (width <= 0 || height <= 0)
+    return false;
+
+  bool piped = false;
+  std::FILE *stream = OpenStream(config.path, piped);
+  if (!stream)
+    return false;
+  std::FILE *timestamps = nullptr;
+  if (!config.timestampPath.empty()) {
+    timestamps = std::fopen(config.timestampPath.c_str(), "w");
+    if (!timestamps) {
+      CloseStream(stream, piped);
+      return false;
+    }
+    std::fputs("frame,sim_tick,sim_ms,wall_ms\n", timestamps);
+  }
+
+  // Frames are large; write them in big chunks.
+  std::setvbuf(stream, nullptr, _IOFBF, 1 << 20);
+  if (config.format == VideoFormat::Y4m) {
+    // C420jpeg: chroma sited between the 2x2 luma block it averages.
+    std::fprintf(stream,
+                 "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg "
+                 "XCOLORRANGE=LIMITED\n",
+                 width, height, config.fps > 0 ? config.fps : 60);
+  }
+
+  Recorder &r = g_rec;
+  r.stream = stream;
+  r.timestamps = timestamps;
+  r.piped = piped;
+  r.format = config.format;
+  r.width = width;
+  r.height = height;
+  const size_t pixels = static_cast<size_t>(width) * height;
+  const size_t chroma =
+      static_cast<size_t>((width + 1) / 2) * ((height + 1) / 2);
+  r.converted.resize(config.format == VideoFormat::Y4m ? pixels + chroma * 2
+                                                        : 0);
+  ReserveReadbackSlots(r.queue, width, height);
+  r.frameIndex = 0;
+  r.writeFailed = false;
+  r.framesCaptured = 0;
+  r.framesSkipped = 0;
+  r.haveFirstFrame = false;
+  r.queue.stats = {};
+  StartReadbackWriter(r.queue, WriteFrame);
+  return true;
+}
+
+void RecordFrame(uint64_t simTick) {
+  Recorder &r = g_rec;
+  if (!IsReadbackWriterRunning(r.queue))
+    return;
+  int width = 0;
+  int height = 0;
+  GetFrameSize(width, height);
+  if (width != r.width || height != r.height) {
+    ++r.framesSkipped;
+    return;
+  }
+
+  const Clock::time_point now = Clock::now();
+  if (!r.haveFirstFrame) {
+    r.haveFirstFrame = true;
+    r.firstTick = simTick;
+    r.firstTime = now;
+  }
+
+  const int index = AcquireReadbackSlot(r.queue, width, height);
+  if (!ReadFramePixels(r.queue.slots[index].pixels.data(), width, height)) {
+    ReleaseReadbackSlot(r.queue, index);
+    return;
+  }
+  FrameStamp &stamp = r.stamps[index];
+  stamp.simTick = simTick;
+  stamp.simMs = static_cast<double>(simTick - r.firstTick) *
+                static_cast<double>(cfg::kFixedDt) * 1000.0;
+  stamp.wallMs =
+      std::chrono::duration<double, std::milli>(now - r.firstTime).count();
+  ++r.framesCaptured;
+  SubmitReadbackSlot(r.queue, index);
+}
+
+void StopRecording() {
+  Recorder &r = g_rec;
+  if (!IsReadbackWriterRunning(r.queue))
+    return;
+  StopReadbackWriter(r.queue);
+
+  CloseStream(r.stream, r.piped);
+  if (r.timestamps)
+    std::fclose(r.timestamps);
+  r.stream = nullptr;
+  r.timestamps = nullptr;
+  r.converted = {};
+}
+
+bool IsRecording() { return IsReadbackWriterRunning(g_rec.queue); }
+
+RecorderStats GetRecorderStats() {
+  const Recorder &r = g_rec;
+  const ReadbackStats stats = GetReadbackStats(g_rec.queue);
+  RecorderStats out;
+  out.width = r.width;
+  out.height = r.height;
+  out.framesCaptured = r.framesCaptured;
+  out.framesWritten = stats.written;
+  out.framesDropped = stats.failed + r.framesSkipped;
+  out.stalls = stats.stalls;
+  return out;
+}
+
+void ConvertRgbaToYuv420(const unsigned char *rgba, int width, int height,
+                         unsigned char *yuv) {
+  const int cw = (width + 1) / 2;
+  const int ch = (height + 1) / 2;
+  unsigned char *yPlane = yuv;
+  unsigned char *uPlane = yuv + static_cast<size_t>(width) * height;
+  unsigned char *vPlane = uPlane + static_cast<size_t>(cw) * ch;
+
+  // BT.601 limited range in 8-bit fixed point.
+  for (int i = 0; i < width * height; ++i) {
+    const int r = rgba[i * 4 + 0];
+    const int g = rgba[i * 4 + 1];
+    const int b = rgba[i * 4 + 2];
+    yPlane[i] =
+        static_cast<unsigned char>(((66 * r + 129 * g + 25 * b + 128) >> 8) +
+                                   16);
+  }
+
+  // Each chroma sample averages its 2x2 block, clamped at odd edges.
+  for (int cy = 0; cy < ch; ++cy) {
+    const int y0 = cy * 2;
+    const int y1 = y0 + 1 < height ? y0 + 1 : y0;
+    for (int cx = 0; cx < cw; ++cx) {
+      const int x0 = cx * 2;
+      const int x1 = x0 + 1 < width ? x0 + 1 : x0;
+      const int corners[4] = {y0 * width + x0, y0 * width + x1,
+                              y1 * width + x0, y1 * width + x1};
+      int r = 2;
+      int g = 2;
+      int b = 2;
+      for (int c : corners) {
+        r += rgba[c * 4 + 0];
+        g += rgba[c * 4 + 1];
+        b += rgba[c * 4 + 2];
+      }
+      r >>= 2;
+      g >>= 2;
+      b >>= 2;
+      const int i = cy * cw + cx;
+      uPlane[i] = static_cast<unsigned char>(
+          ((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+      vPlane[i] = static_cast<unsigned char>(
+          ((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+    }
+  }
+}
+
+} // namespace render
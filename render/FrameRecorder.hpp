@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Streaming video capture.
+//
+// While recording, every frame handed to RecordFrame is read back into one
+// of cfg::kFrameRecorderSlots pooled buffers. A writer thread converts it
+// and appends it to a single stream: YUV4MPEG2 (4:2:0, BT.601 limited
+// range) or headerless RGB24. No per-frame compression happens, so the
+// stream can go straight to a file or be piped into an encoder. Frames
+// keep their order; when every buffer is in flight RecordFrame blocks
+// rather than dropping a frame.
+//
+// An optional CSV timestamp track gets one line per frame:
+// frame index, sim tick, sim time and wall time since the first frame,
+// both in milliseconds.
+//
+// Main thread only, with one recording at a time.
+
+namespace render {
+
+enum class VideoFormat { Y4m, Raw };
+
+struct RecorderConfig {
+  std::string path; // File path, or "|command" to pipe into a process
+  VideoFormat format = VideoFormat::Y4m;
+  int fps = 60;              // Nominal rate written to the Y4M header
+  std::string timestampPath; // Empty: no timestamp track
+};
+
+struct RecorderStats {
+  int width = 0;
+  int height = 0;
+  int framesCaptured = 0;
+  int framesWritten = 0;
+  int framesDropped = 0; // Wrong size, failed readback or write error
+  int stalls = 0;        // Captures that waited for a free buffer
+};
+
+// Opens the stream; the frame size is fixed to the current GetFrameSize.
+// False if a recording is already running or the output can't be opened.
+bool StartRecording(const RecorderConfig &config);
+
+// Capture the frame RenderFrame just finished, stamped with `simTick`.
+void RecordFrame(uint64_t simTick);
+
+// Write out every queued frame and close the stream. No-op when idle.
+void StopRecording();
+
+bool IsRecording();
+RecorderStats GetRecorderStats();
+
+// Top-down RGBA8 to planar Y, U, V at 4:2:0 (chroma planes are
+// ceil(width / 2) x ceil(height / 2)). Exposed for tests.
+void ConvertRgbaToYuv420(const unsigned char *rgba, int width, int height,
+                         unsigned char *yuv);
+
+} // namespace render
@@ -0,0 +1,87 @@
+#include "render/FrameTarget.hpp"
+
+#include <cstddef>
+#include <cstring>
+
+#include "rlgl.h"
+
+namespace render {
+
+namespace {
+
+const RenderTexture2D *g_target = nullptr;
+bool g_inFrame = false;
+
+} // namespace
+
+void SetFrameTarget(const RenderTexture2D *target) {
+  if (!g_inFrame)
+    g_target = target;
+}
+
+bool IsOffscreenFrame() { return g_target != nullptr; }
+
+const RenderTexture2D *GetFrameTarget() { return g_target; }
+
+void BeginFrame() {
+  g_inFrame = true;
+  if (g_target)
+    BeginTextureMode(*g_target);
+  else
+    BeginDrawing();
+}
+
+void EndFrame() {
+  if (g_target)
+    EndTextureMode();
+  else
+    EndDrawing();
+  g_inFrame = false;
+}
+
+void BeginCacheTexture(const RenderTexture2D &target) {
+  BeginTextureMode(target);
+}
+
+void EndCacheTexture() {
+  EndTextureMode();
+  // EndTextureMode falls back to the window; resume the offscreen frame.
+  if (g_inFrame && g_target)
+    BeginTextureMode(*g_target);
+}
+
+void GetFrameSize(int &width, int &height) {
+  if (g_target) {
+    width = g_target->texture.width;
+    height = g_target->texture.height;
+  } else {
+    width = GetRenderWidth();
+    height = GetRenderHeight();
+  }
+}
+
+bool ReadFramePixels(unsigned char *rgba, int width, int height) {
+  const size_t rowBytes = static_cast<size_t>(width) * 4;
+  // rlgl hands back its own allocation; copy it into the caller's buffer.
+  unsigned char *src = nullptr;
+  if (g_target) {
+    src = static_cast<unsigned char *>(
+        rlReadTexturePixels(g_target->texture.id, width, height,
+                            PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+    // Render textures are stored bottom-up.
+    for (int y = 0; src && y < height; ++y) {
+      std::memcpy(rgba + rowBytes * y, src + rowBytes * (height - 1 - y),
+                  rowBytes);
+    }
+  } else {
+    src = rlReadScreenPixels(width, height);
+    if (src)
+      std::memcpy(rgba, src, rowBytes * height);
+  }
+  if (!src)
+    return false;
+  MemFree(src);
+  return true;
+}
+
+} // namespace render
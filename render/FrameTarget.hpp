@@ -0,0 +1,40 @@
+#pragma once
+
+#include <raylib.h>
+
+// Where RenderFrame draws.
+//
+// By default frames go to the window's back buffer (BeginDrawing /
+// EndDrawing). Tools can point the frame at a render texture instead; the
+// frame is then rendered without presenting anything and read back with
+// LoadImageFromTexture. The texture must be cfg::kScreenWidth x
+// cfg::kScreenHeight, since all layout and viewport maths uses those.
+//
+// Cached layers (HUD, backdrop, labels) render into their own textures in
+// the middle of a frame. raylib has no nested texture modes, so they go
+// through BeginCacheTexture / EndCacheTexture, which rebind the frame
+// target afterwards.
+
+namespace render {
+
+// nullptr restores the window back buffer. Not while a frame is open.
+void SetFrameTarget(const RenderTexture2D *target);
+bool IsOffscreenFrame();
+const RenderTexture2D *GetFrameTarget(); // nullptr for the window
+
+void BeginFrame();
+void EndFrame();
+
+void BeginCacheTexture(const RenderTexture2D &target);
+void EndCacheTexture();
+
+// Size of the frame RenderFrame draws: the frame target, else the window
+// framebuffer (HiDPI included).
+void GetFrameSize(int &width, int &height);
+
+// Copy the last finished frame into `rgba` as top-down RGBA8, `width` x
+// `height` from GetFrameSize. Call after EndFrame. False if the readback
+// failed.
+bool ReadFramePixels(unsigned char *rgba, int width, int height);
+
+} // namespace render
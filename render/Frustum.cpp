@@ -0,0 +1,236 @@
+#include "render/Frustum.hpp"
+
+#include <cmath>
+
+#include "rlgl.h"
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SKYROADS_CULL_SSE 1
+#else
+#define SKYROADS_CULL_SSE 0
+#endif
+
+namespace render {
+
+namespace {
+
+Frustum g_view;
+CullStats g_stats;
+
+Vector3 Normalize(Vector3 v) {
+  const float len = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+  if (len < 1e-6f)
+    return {0.0f, 0.0f, 0.0f};
+  return {v.x / len, v.y / len, v.z / len};
+}
+
+Vector3 Cross(Vector3 a, Vector3 b) {
+  return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+          a.x * b.y - a.y * b.x};
+}
+
+float Dot(Vector3 a, Vector3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+void SetPlane(Frustum &f, int i, Vector3 n, Vector3 through) {
+  f.nx[i] = n.x;
+  f.ny[i] = n.y;
+  f.nz[i] = n.z;
+  f.d[i] = -Dot(n, through);
+}
+
+int VisibleTail(const Frustum &f, const float *x, const float *y,
+                const float *z, const float *ex, const float *ey,
+                const float *ez, const float *r, int first, int count,
+                unsigned char *visible) {
+  int n = 0;
+  for (int i = first; i < count; ++i) {
+    const bool in =
+        r ? SphereInFrustum(f, {x[i], y[i], z[i]}, r[i])
+          : BoxInFrustum(f, {x[i], y[i], z[i]}, {ex[i], ey[i], ez[i]});
+    visible[i] = in ? 1 : 0;
+    n += in ? 1 : 0;
+  }
+  return n;
+}
+
+#if SKYROADS_CULL_SSE
+int StoreMask(int mask, unsigned char *visible) {
+  int n = 0;
+  for (int k = 0; k < 4; ++k) {
+    visible[k] = static_cast<unsigned char>((mask >> k) & 1);
+    n += visible[k];
+  }
+  return n;
+}
+#endif
+
+} // namespace
+
+// ─── Construction
+// ─────────────────────────────────────────────────────────────
+
+Frustum MakeFrustum(const Camera3D &camera, float aspect, float nearZ,
+                    float farZ) {
+  Frustum f;
+  if (camera.projection != CAMERA_PERSPECTIVE)
+    return f;
+
+  // Same basis as MatrixLookAt: forward, right, and the re-orthogonalised up.
+  const Vector3 eye = camera.position;
+  const Vector3 fwd = Normalize({camera.target.x - eye.x,
+                                 camera.target.y - eye.y,
+                                 camera.target.z - eye.z});
+  const Vector3 right = Normalize(Cross(fwd, camera.up));
+  const Vector3 up = Cross(right, fwd);
+  const float tanV = std::tan(camera.fovy * DEG2RAD * 0.5f);
+  const float tanH = tanV * aspect;
+
+  // A side plane's inward normal n = side + fwd * tan satisfies
+  // n . (fwd - side * tan) = 0 on the boundary and n . fwd > 0 inside.
+  const auto side = [&](Vector3 s, float t) {
+    return Normalize({s.x + fwd.x * t, s.y + fwd.y * t, s.z + fwd.z * t});
+  };
+  SetPlane(f, 0, fwd,
+           {eye.x + fwd.x * nearZ, eye.y + fwd.y * nearZ,
+            eye.z + fwd.z * nearZ});
+  SetPlane(f, 1, {-fwd.x, -fwd.y, -fwd.z},
+           {eye.x + fwd.x * farZ, eye.y + fwd.y * farZ, eye.z + fwd.z * farZ});
+  SetPlane(f, 2, side(right, tanH), eye);
+  SetPlane(f, 3, side({-right.x, -right.y, -right.z}, tanH), eye);
+  SetPlane(f, 4, side(up, tanV), eye);
+  SetPlane(f, 5, side({-up.x, -up.y, -up.z}, tanV), eye);
+  return f;
+}
+
+// ─── Tests
+// ────────────────────────────────────────────────────────────────────
+
+bool SphereInFrustum(const Frustum &f, Vector3 c, float radius) {
+  for (int i = 0; i < 6; ++i) {
+    if (f.nx[i] * c.x + f.ny[i] * c.y + f.nz[i] * c.z + f.d[i] < -radius)
+      return false;
+  }
+  return true;
+}
+
+bool BoxInFrustum(const Frustum &f, Vector3 c, Vector3 e) {
+  for (int i = 0; i < 6; ++i) {
+    // Projected radius of the box onto the plane normal.
+    const float r = std::fabs(f.nx[i]) * e.x + std::fabs(f.ny[i]) * e.y +
+                    std::fabs(f.nz[i]) * e.z;
+    if (f.nx[i] * c.x + f.ny[i] * c.y + f.nz[i] * c.z + f.d[i] < -r)
+      return false;
+  }
+  return true;
+}
+
+int SpheresInFrustum(const Frustum &f, const float *x, const float *y,
+                     const float *z, const float *r, int count,
+                     unsigned char *visible) {
+  int i = 0;
+  int n = 0;
+#if SKYROADS_CULL_SSE
+  for (; i + 4 <= count; i += 4) {
+    const __m128 px = _mm_loadu_ps(x + i);
+    const __m128 py = _mm_loadu_ps(y + i);
+    const __m128 pz = _mm_loadu_ps(z + i);
+    const __m128 negR = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(r + i));
+    __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    for (int p = 0; p < 6; ++p) {
+      const __m128 dist = _mm_add_ps(
+          _mm_add_ps(_mm_mul_ps(px, _mm_set1_ps(f.nx[p])),
+                     _mm_mul_ps(py, _mm_set1_ps(f.ny[p]))),
+          _mm_add_ps(_mm_mul_ps(pz, _mm_set1_ps(f.nz[p])),
+                     _mm_set1_ps(f.d[p])));
+      inside = _mm_and_ps(inside, _mm_cmpge_ps(dist, negR));
+    }
+    n += StoreMask(_mm_movemask_ps(inside), visible + i);
+  }
+#endif
+  return n + VisibleTail(f, x, y, z, nullptr, nullptr, nullptr, r, i, count,
+                         visible);
+}
+
+int BoxesInFrustum(const Frustum &f, const float *x, const float *y,
+                   const float *z, const float *ex, const float *ey,
+                   const float *ez, int count, unsigned char *visible) {
+  int i = 0;
+  int n = 0;
+#if SKYROADS_CULL_SSE
+  for (; i + 4 <= count; i += 4) {
+    const __m128 px = _mm_loadu_ps(x + i);
+    const __m128 py = _mm_loadu_ps(y + i);
+    const __m128 pz = _mm_loadu_ps(z + i);
+    const __m128 hx = _mm_loadu_ps(ex + i);
+    const __m128 hy = _mm_loadu_ps(ey + i);
+    const __m128 hz = _mm_loadu_ps(ez + i);
+    __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    for (int p = 0; p < 6; ++p) {
+      const __m128 dist = _mm_add_ps(
+          _mm_add_ps(_mm_mul_ps(px, _mm_set1_ps(f.nx[p])),
+                     _mm_mul_ps(py, _mm_set1_ps(f.ny[p]))),
+          _mm_add_ps(_mm_mul_ps(pz, _mm_set1_ps(f.nz[p])),
+                     _mm_set1_ps(f.d[p])));
+      const __m128 radius = _mm_add_ps(
+          _mm_add_ps(_mm_mul_ps(hx, _mm_set1_ps(std::fabs(f.nx[p]))),
+                     _mm_mul_ps(hy, _mm_set1_ps(std::fabs(f.ny[p])))),
+          _mm_mul_ps(hz, _mm_set1_ps(std::fabs(f.nz[p]))));
+      inside = _mm_and_ps(
+          inside,
+          _mm_cmpge_ps(dist, _mm_sub_ps(_mm_setzero_ps(), radius)));
+    }
+    n += StoreMask(_mm_movemask_ps(inside), visible + i);
+  }
+#endif
+  return n + VisibleTail(f, x, y, z, ex, ey, ez, nullptr, i, count, visible);
+}
+
+// ─── View frustum
+// ─────────────────────────────────────────────────────────────
+
+void BeginCullFrame(const Camera3D &camera, float aspect) {
+  // Same clip distances rlgl uses for the BeginMode3D projection.
+  g_view = MakeFrustum(camera, aspect,
+                       static_cast<float>(RL_CULL_DISTANCE_NEAR),
+                       static_cast<float>(RL_CULL_DISTANCE_FAR));
+  g_stats = {};
+}
+
+const Frustum &GetViewFrustum() { return g_view; }
+
+bool IsSphereVisible(Vector3 center, float radius) {
+  const bool in = SphereInFrustum(g_view, center, radius);
+  ++g_stats.tested;
+  g_stats.culled += in ? 0 : 1;
+  return in;
+}
+
+bool IsBoxVisible(Vector3 center, Vector3 halfExtents) {
+  const bool in = BoxInFrustum(g_view, center, halfExtents);
+  ++g_stats.tested;
+  g_stats.culled += in ? 0 : 1;
+  return in;
+}
+
+int CullSpheres(const float *x, const float *y, const float *z,
+                const float *r, int count, unsigned char *visible) {
+  const int n = SpheresInFrustum(g_view, x, y, z, r, count, visible);
+  g_stats.tested += count;
+  g_stats.culled += count - n;
+  return n;
+}
+
+int CullBoxes(const float *x, const float *y, const float *z,
+              const float *ex, const float *ey, const float *ez, int count,
+              unsigned char *visible) {
+  const int n = BoxesInFrustum(g_view, x, y, z, ex, ey, ez, count, visible);
+  g_stats.tested += count;
+  g_stats.culled += count - n;
+  return n;
+}
+
+const CullStats &GetCullStats() { return g_stats; }
+
+} // namespace render
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <raylib.h>
+
+// View-frustum culling shared by the world renderers.
+//
+// RenderFrame builds the frustum from game.camera once per frame
+// (BeginCullFrame). Renderers with many objects fill a SphereBatch or
+// BoxBatch with structure-of-arrays bounds and cull them in one pass, four
+// at a time where SSE is available; one-off objects use the scalar tests.
+// Every test against the view frustum feeds the per-frame CullStats.
+
+namespace render {
+
+// Six inward-facing planes (near, far, left, right, bottom, top) stored as
+// SoA: a point p is inside plane i when n_i . p + d_i >= 0. A default
+// constructed frustum accepts everything.
+struct Frustum {
+  float nx[6] = {};
+  float ny[6] = {};
+  float nz[6] = {};
+  float d[6] = {};
+};
+
+// `aspect` is width / height of the projection. Orthographic cameras get
+// the accept-all frustum.
+Frustum MakeFrustum(const Camera3D &camera, float aspect, float nearZ,
+                    float farZ);
+
+bool SphereInFrustum(const Frustum &f, Vector3 center, float radius);
+bool BoxInFrustum(const Frustum &f, Vector3 center, Vector3 halfExtents);
+
+// Batch tests over SoA bounds. Write 1/0 per entry to `visible` and return
+// the number of visible entries.
+int SpheresInFrustum(const Frustum &f, const float *x, const float *y,
+                     const float *z, const float *r, int count,
+                     unsigned char *visible);
+int BoxesInFrustum(const Frustum &f, const float *x, const float *y,
+                   const float *z, const float *ex, const float *ey,
+                   const float *ez, int count, unsigned char *visible);
+
+struct CullStats {
+  int tested = 0;
+  int culled = 0;
+};
+
+// Build this frame's view frustum and reset CullStats.
+void BeginCullFrame(const Camera3D &camera, float aspect);
+const Frustum &GetViewFrustum();
+
+// View-frustum tests that count towards CullStats.
+bool IsSphereVisible(Vector3 center, float radius);
+bool IsBoxVisible(Vector3 center, Vector3 halfExtents);
+int CullSpheres(const float *x, const float *y, const float *z,
+                const float *r, int count, unsigned char *visible);
+int CullBoxes(const float *x, const float *y, const float *z,
+              const float *ex, const float *ey, const float *ez, int count,
+              unsigned char *visible);
+
+const CullStats &GetCullStats();
+
+// Fixed-capacity SoA bounds filled per frame. `id` maps each entry back to
+// the caller's object index.
+template <int Capacity> struct SphereBatch {
+  float x[Capacity];
+  float y[Capacity];
+  float z[Capacity];
+  float r[Capacity];
+  int id[Capacity];
+  unsigned char visible[Capacity];
+  int count = 0;
+
+  void Clear() { count = 0; }
+  void Add(int objectId, Vector3 center, float radius) {
+    if (count == Capacity)
+      return;
+    x[count] = center.x;
+    y[count] = center.y;
+    z[count] = center.z;
+    r[count] = radius;
+    id[count++] = objectId;
+  }
+  int Cull() { return CullSpheres(x, y, z, r, count, visible); }
+};
+
+template <int Capacity> struct BoxBatch {
+  float x[Capacity];
+  float y[Capacity];
+  float z[Capacity];
+  float ex[Capacity];
+  float ey[Capacity];
+  float ez[Capacity];
+  int id[Capacity];
+  unsigned char visible[Capacity];
+  int count = 0;
+
+  void Clear() { count = 0; }
+  void Add(int objectId, Vector3 center, Vector3 halfExtents) {
+    if (count == Capacity)
+      return;
+    x[count] = center.x;
+    y[count] = center.y;
+    z[count] = center.z;
+    ex[count] = halfExtents.x;
+    ey[count] = halfExtents.y;
+    ez[count] = halfExtents.z;
+    id[count++] = objectId;
+  }
+  int Cull() { return CullBoxes(x, y, z, ex, ey, ez, count, visible); }
+};
+
+} // namespace render
@@ -7,10 +7,17 @@ struct LevelPalette;
 
 namespace render {
 
+// Gate geometry is cached per zone and palette (see render/Prefab.hpp);
+// `paletteIndex` identifies `pal` for the cache.
 void RenderFinishLine(const Level &level, const Vector3 &playerRenderPos,
-                      const LevelPalette &pal, float simTime);
+                      const LevelPalette &pal, int paletteIndex,
+                      float simTime);
 
 void RenderStartLine(const Level &level, const Vector3 &playerRenderPos,
-                     const LevelPalette &pal, float simTime);
+                     const LevelPalette &pal, int paletteIndex,
+                     float simTime);
+
+// Free the cached gate prefabs. Renderer shutdown only.
+void UnloadGatePrefabs();
 
 } // namespace render
@@ -6,9 +6,21 @@
 #include <cstring>
 
 #include "core/Config.hpp"
+#include "core/Log.hpp"
 #include "game/Game.hpp"
+#include "render/CubeBatch.hpp"
+#include "render/DrawStats.hpp"
+#include "render/EndlessMesh.hpp"
+#include "render/FrameTarget.hpp"
+#include "render/Frustum.hpp"
+#include "render/LevelMesh.hpp"
+#include "render/LevelPreload.hpp"
+#include "render/Lod.hpp"
 #include "render/Palette.hpp"
+#include "render/Prefab.hpp"
+#include "render/Render.hpp"
 #include "render/RenderUtils.hpp"
+#include "rlgl.h"
 
 // External texture state owned by Render.cpp
 namespace render {
@@ -175,57 +187,205 @@ static void DrawSegmentedGauge(int cx, int cy, float radius, int segCount,
 }
 
 // Draw a grid pattern covering (0,0)→(width,height).
-static void DrawGridOverlay(const LevelPalette &pal, int width, int height,
+static void DrawGridOverlay(Color gridLine, int width, int height,
                             float alpha) {
   const int gridSpacing = 40;
-  const Color gridColor = Fade(pal.gridLine, 0.4f * alpha);
+  const Color gridColor = Fade(gridLine, 0.4f * alpha);
   for (int x = 0; x <= width; x += gridSpacing)
     DrawLine(x, 0, x, height, gridColor);
   for (int y = 0; y <= height; y += gridSpacing)
     DrawLine(0, y, width, y, gridColor);
 
   const int diagSpacing = 60;
-  const Color diagColor = Fade(pal.gridLine, 0.15f * alpha);
+  const Color diagColor = Fade(gridLine, 0.15f * alpha);
   for (int i = -height; i < width + height; i += diagSpacing) {
     DrawLine(i, 0, i + height, height, diagColor);
     DrawLine(i, 0, i - height, height, diagColor);
   }
 }
 
-// ─── Public functions
+// ─── Cockpit HUD cache
 // ─────────────────────────────────────────────────────────
+//
+// The cockpit is drawn in two layers. The static layer (console, bevels,
+// display wells, captions) only depends on the palette and is rendered once
+// into g_hudStatic. The dynamic layer depends on a handful of quantised
+// values (CockpitState); whenever they change, g_hudFrame is rebuilt from
+// the static layer plus the widgets. Every other frame the HUD is a single
+// textured quad.
+
+// Everything the dynamic layer reads. Gauge fills are quantised to half a
+// degree, well below what the pie triangulation can show.
+struct CockpitState {
+  char gravText[16] = {};
+  bool gravLight = false;
+  bool jumpLight = false;
+  int jumpStatus = 0; // Index into kJumpStatus
+  int speedFill = 0;  // Gauge fill * kGaugeSteps
+  int fuelFill = 0;
+  int o2Fill = 0;
+  int throttleW = 0;
+  unsigned int uiText = 0;
+
+  bool operator==(const CockpitState &) const = default;
+};
 
-void DrawBackgroundWithGrid(int textureIndex, float scrollOffset,
-                            const LevelPalette &pal, int width, int height,
-                            float alpha) {
-  if (!g_backgroundTexturesLoaded || textureIndex < 0 || textureIndex >= 4 ||
-      g_backgroundTextures[textureIndex].id == 0) {
-    DrawGridOverlay(pal, width, height, alpha);
-    return;
+constexpr float kGaugeSteps = 720.0f;
+constexpr const char *kJumpStatus[] = {"IDLE", "DASH", "JUMPING", "READY"};
+
+// Grav meter digits: 32 px with 4 px spacing, pre-rendered with their glow
+// on the display's black background into one row of 36x36 cells.
+constexpr int kGravDigitSize = 32;
+constexpr int kGravDigitSpacing = 4;
+constexpr int kDigitCell = kGravDigitSize + kGravDigitSpacing;
+constexpr Color kGravDigitColor = {0, 255, 100, 255};
+constexpr Color kGravGlowColor = {0, 255, 150, 255};
+
+static RenderTexture2D g_hudStatic = {};
+static RenderTexture2D g_hudFrame = {};
+static RenderTexture2D g_digitAtlas = {};
+static bool g_hudStaticValid = false;
+static bool g_hudFrameValid = false;
+static bool g_digitAtlasReady = false;
+static bool g_hudTargetsFailed = false;
+static unsigned int g_hudStaticText = 0;
+static CockpitState g_hudFrameState;
+
+static unsigned int PackColor(Color c) {
+  return (static_cast<unsigned int>(c.r) << 24) |
+         (static_cast<unsigned int>(c.g) << 16) |
+         (static_cast<unsigned int>(c.b) << 8) | c.a;
+}
+
+// Cached layers hold premultiplied colour, as the backdrop cache does:
+// colour blends as usual but alpha accumulates as 1 - prod(1 - a), so the
+// translucent glow passes leave the same result as drawing directly once the
+// layer is composited with BLEND_ALPHA_PREMULTIPLY.
+static void BeginLayerBlend() {
+  rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE,
+                            RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+  BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+}
+
+// Draw in screen coordinates into a cleared target covering the bottom of
+// the screen from `originY` down.
+static void BeginCockpitTarget(const RenderTexture2D &target, int originY) {
+  BeginCacheTexture(target);
+  ClearBackground(BLANK);
+  rlPushMatrix();
+  rlTranslatef(0.0f, static_cast<float>(-originY), 0.0f);
+  BeginLayerBlend();
+}
+
+static void EndCockpitTarget() {
+  EndBlendMode();
+  rlPopMatrix();
+  EndCacheTexture();
+}
+
+// Render textures are stored upside down. Cached layers are premultiplied;
+// the caller sets BLEND_ALPHA_PREMULTIPLY.
+static void DrawRenderTexture(const RenderTexture2D &target, int y) {
+  DrawTextureRec(target.texture,
+                 Rectangle{0.0f, 0.0f,
+                           static_cast<float>(target.texture.width),
+                           -static_cast<float>(target.texture.height)},
+                 Vector2{0.0f, static_cast<float>(y)}, WHITE);
+}
+
+static bool EnsureCockpitTargets() {
+  if (g_hudTargetsFailed)
+    return false;
+  if (g_hudFrame.id != 0)
+    return true;
+
+  const int hudHeight = cfg::kScreenHeight - cfg::kScreenHeight * 2 / 3;
+  g_hudStatic = LoadRenderTexture(cfg::kScreenWidth, hudHeight);
+  g_hudFrame = LoadRenderTexture(cfg::kScreenWidth, hudHeight);
+  g_digitAtlas = LoadRenderTexture(kDigitCell * 10, kDigitCell);
+  if (g_hudStatic.id == 0 || g_hudFrame.id == 0 || g_digitAtlas.id == 0) {
+    LOG_WARN("HUD: render textures unavailable, drawing directly");
+    UnloadCockpitHUD();
+    g_hudTargetsFailed = true;
+    return false;
   }
 
-  const Texture2D &tex = g_backgroundTextures[textureIndex];
-  const float texScale =
-      static_cast<float>(height) / static_cast<float>(tex.height);
-  const float texW = static_cast<float>(tex.width) * texScale;
-  const float scrollX = std::fmod(scrollOffset, texW);
+  BeginCacheTexture(g_digitAtlas);
+  ClearBackground(BLANK);
+  BeginLayerBlend();
+  for (int d = 0; d < 10; ++d) {
+    Draw7SegmentDigit(d * kDigitCell, 0, static_cast<char>('0' + d),
+                      kGravDigitSize, kGravDigitColor, kGravGlowColor);
+  }
+  EndBlendMode();
+  EndCacheTexture();
+  g_digitAtlasReady = true;
+  return true;
+}
 
-  for (int x = -1; x <= 1; ++x) {
-    const float drawX = scrollX + static_cast<float>(x) * texW;
-    DrawTexturePro(
-        tex,
-        Rectangle{0.0f, 0.0f, static_cast<float>(tex.width),
-                  static_cast<float>(tex.height)},
-        Rectangle{drawX, 0.0f, texW, static_cast<float>(height)},
-        Vector2{0.0f, 0.0f}, 0.0f,
-        Color{255, 255, 255, static_cast<unsigned char>(255 * alpha)});
+// Draw7SegmentNumber for the grav meter style, one atlas quad per digit.
+// The atlas is only ready when the HUD is cached, so this runs inside the
+// g_hudFrame bake and goes back to its layer blend.
+static void DrawGravNumber(int x, int y, const char *number) {
+  if (!g_digitAtlasReady) {
+    Draw7SegmentNumber(x, y, number, kGravDigitSize, kGravDigitSpacing,
+                       kGravDigitColor, kGravGlowColor);
+    return;
+  }
+  BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+  int curX = x;
+  for (int i = 0; number[i] != '\0'; ++i) {
+    if (number[i] >= '0' && number[i] <= '9') {
+      const float cellX = static_cast<float>((number[i] - '0') * kDigitCell);
+      DrawTextureRec(g_digitAtlas.texture,
+                     Rectangle{cellX, 0.0f, static_cast<float>(kDigitCell),
+                               -static_cast<float>(kDigitCell)},
+                     Vector2{static_cast<float>(curX), static_cast<float>(y)},
+                     WHITE);
+      curX += kDigitCell;
+    } else if (number[i] == ' ') {
+      curX += kGravDigitSize / 2;
+    }
   }
+  BeginLayerBlend();
+}
+
+static CockpitState MakeCockpitState(const Game &game,
+                                     const LevelPalette &pal,
+                                     float planarSpeed) {
+  CockpitState s;
+  const float gravValue = std::abs(game.player.velocity.y) * 10.0f;
+  std::snprintf(s.gravText, sizeof(s.gravText), "%.0f", gravValue);
+  s.gravLight = gravValue > 1.0f;
+
+  s.jumpLight = game.player.dashTimer > 0.0f || !game.player.grounded;
+  if (game.player.dashTimer > 0.0f)
+    s.jumpStatus = 1;
+  else if (!game.player.grounded)
+    s.jumpStatus = 2;
+  else if (game.player.jumpBufferTimer > 0.0f)
+    s.jumpStatus = 3;
 
-  DrawGridOverlay(pal, width, height, alpha);
+  const float speedNorm = Clamp01(planarSpeed / cfg::kThrottleSpeedMax);
+  const float fuelNorm =
+      1.0f - (game.player.dashCooldownTimer / cfg::kDashCooldown);
+  const float o2Norm = Clamp01(game.runTime / 300.0f);
+  s.speedFill = static_cast<int>(std::lround(speedNorm * kGaugeSteps));
+  s.fuelFill = static_cast<int>(std::lround(fuelNorm * kGaugeSteps));
+  s.o2Fill = static_cast<int>(std::lround(o2Norm * kGaugeSteps));
+  s.throttleW = static_cast<int>(game.throttle * 300);
+  s.uiText = PackColor(pal.uiText);
+  return s;
 }
 
-void RenderCockpitHUD(const Game &game, const LevelPalette &pal,
-                      float planarSpeed) {
+// Layout shared by both layers.
+constexpr int kHudPanelW = 180;
+constexpr int kHudPanelH = 100;
+constexpr int kHudDisplayW = kHudPanelW - 20;
+constexpr int kHudDisplayH = 50;
+constexpr float kHudGaugeR = 55.0f;
+
+static void DrawCockpitStatic(const LevelPalette &pal) {
   const int hudStartY = cfg::kScreenHeight * 2 / 3;
   const int hudHeight = cfg::kScreenHeight - hudStartY;
   const int centerX = cfg::kScreenWidth / 2;
@@ -238,141 +398,466 @@ void RenderCockpitHUD(const Game &game, const LevelPalette &pal,
                                  static_cast<float>(hudHeight)},
                        2.0f, Color{30, 35, 40, 255});
 
-  // ── Left panel: GRAV-C METER ──────────────────────────────────────────────
-  const int leftPanelX = 40;
-  const int leftPanelY = hudStartY + 20;
-  const int panelW = 180;
-  const int panelH = 100;
-  const int displayW = panelW - 20;
-  const int displayH = 50;
-
-  DrawBeveledRectangle(leftPanelX, leftPanelY, panelW, panelH,
-                       Color{30, 35, 40, 255}, 3);
+  // Both side panels: bevel, black display well and caption
+  const int panelY = hudStartY + 20;
+  const int panelXs[2] = {40, cfg::kScreenWidth - kHudPanelW - 40};
+  for (int panelX : panelXs) {
+    DrawBeveledRectangle(panelX, panelY, kHudPanelW, kHudPanelH,
+                         Color{30, 35, 40, 255}, 3);
+    const int displayX = panelX + 10;
+    const int displayY = panelY + 15;
+    DrawRectangle(displayX, displayY, kHudDisplayW, kHudDisplayH,
+                  Color{0, 0, 0, 255});
+    DrawRectangleLinesEx(
+        Rectangle{static_cast<float>(displayX), static_cast<float>(displayY),
+                  static_cast<float>(kHudDisplayW),
+                  static_cast<float>(kHudDisplayH)},
+        2.0f, Color{40, 40, 40, 255});
+  }
+  DrawText("GRAV-C METER", panelXs[0] + 20, panelY + 75, 12, pal.uiText);
+  DrawText("JUMP-O MASTER", panelXs[1] + 15, panelY + 75, 12, pal.uiText);
 
-  const float gravValue = std::abs(game.player.velocity.y) * 10.0f;
-  DrawLEDLight(leftPanelX + 15, leftPanelY - 8, 5, Color{0, 255, 0, 255},
-               gravValue > 1.0f);
+  // Central gauge rims
+  const int gaugeCY = hudStartY + 60;
+  DrawCircleLines(centerX, gaugeCY, kHudGaugeR, Color{100, 100, 150, 255});
+  DrawCircleLines(centerX, gaugeCY, kHudGaugeR * 0.7f,
+                  Color{100, 100, 150, 255});
 
-  const int displayX = leftPanelX + 10;
-  const int displayY = leftPanelY + 15;
-  DrawRectangle(displayX, displayY, displayW, displayH, Color{0, 0, 0, 255});
-  DrawRectangleLinesEx(
-      Rectangle{static_cast<float>(displayX), static_cast<float>(displayY),
-                static_cast<float>(displayW), static_cast<float>(displayH)},
-      2.0f, Color{40, 40, 40, 255});
-
-  char gravText[32];
-  std::snprintf(gravText, sizeof(gravText), "%.0f", gravValue);
-  const int digitSize = 32;
-  const int numberW = static_cast<int>(std::strlen(gravText)) * (digitSize + 4);
-  const int numberX = displayX + (displayW - numberW) / 2;
-  const int numberY = displayY + (displayH - digitSize) / 2;
-  Draw7SegmentNumber(numberX, numberY, gravText, digitSize, 4,
-                     Color{0, 255, 100, 255}, Color{0, 255, 150, 255});
-  DrawText("GRAV-C METER", leftPanelX + 20, leftPanelY + 75, 12, pal.uiText);
+  // Throttle well
+  const int throttleBarX = centerX - 150;
+  const int throttleBarY = hudStartY + 140;
+  DrawRectangle(throttleBarX, throttleBarY, 300, 20, Color{20, 25, 30, 255});
+  DrawRectangleLinesEx(Rectangle{static_cast<float>(throttleBarX),
+                                 static_cast<float>(throttleBarY), 300.0f,
+                                 20.0f},
+                       2.0f, Color{80, 90, 100, 255});
+  DrawText("THROTTLE", centerX - 35, throttleBarY - 18, 14, pal.uiText);
 
-  // ── Right panel: JUMP-O MASTER ────────────────────────────────────────────
-  const int rightPanelX = cfg::kScreenWidth - panelW - 40;
-  const int rightPanelY = leftPanelY;
+  // Side-panel decorative strips
+  DrawRectangle(0, hudStartY, 20, hudHeight, Color{40, 45, 50, 255});
+  DrawRectangle(cfg::kScreenWidth - 20, hudStartY, 20, hudHeight,
+                Color{40, 45, 50, 255});
+  for (int i = 0; i < 3; ++i) {
+    DrawRectangle(10 + i * 6, hudStartY + 10, 4, 4, Color{100, 120, 140, 255});
+    DrawRectangle(cfg::kScreenWidth - 14 - i * 6, hudStartY + 10, 4, 4,
+                  Color{100, 120, 140, 255});
+  }
+}
 
-  DrawBeveledRectangle(rightPanelX, rightPanelY, panelW, panelH,
-                       Color{30, 35, 40, 255}, 3);
+static void DrawCockpitDynamic(const CockpitState &s,
+                               const LevelPalette &pal) {
+  const int hudStartY = cfg::kScreenHeight * 2 / 3;
+  const int centerX = cfg::kScreenWidth / 2;
+  const int panelY = hudStartY + 20;
 
-  const bool jumpLightOn =
-      game.player.dashTimer > 0.0f || !game.player.grounded;
-  DrawLEDLight(rightPanelX + 15, rightPanelY - 8, 5, Color{0, 255, 0, 255},
-               jumpLightOn);
+  // ── Left panel: GRAV-C METER ──────────────────────────────────────────────
+  const int leftPanelX = 40;
+  DrawLEDLight(leftPanelX + 15, panelY - 8, 5, Color{0, 255, 0, 255},
+               s.gravLight);
+  const int displayX = leftPanelX + 10;
+  const int displayY = panelY + 15;
+  const int numberW =
+      static_cast<int>(std::strlen(s.gravText)) * (kGravDigitSize + 4);
+  const int numberX = displayX + (kHudDisplayW - numberW) / 2;
+  const int numberY = displayY + (kHudDisplayH - kGravDigitSize) / 2;
+  DrawGravNumber(numberX, numberY, s.gravText);
 
+  // ── Right panel: JUMP-O MASTER ────────────────────────────────────────────
+  const int rightPanelX = cfg::kScreenWidth - kHudPanelW - 40;
+  DrawLEDLight(rightPanelX + 15, panelY - 8, 5, Color{0, 255, 0, 255},
+               s.jumpLight);
+  const char *jumpStatus = kJumpStatus[s.jumpStatus];
   const int rDisplayX = rightPanelX + 10;
-  const int rDisplayY = rightPanelY + 15;
-  DrawRectangle(rDisplayX, rDisplayY, displayW, displayH, Color{0, 0, 0, 255});
-  DrawRectangleLinesEx(
-      Rectangle{static_cast<float>(rDisplayX), static_cast<float>(rDisplayY),
-                static_cast<float>(displayW), static_cast<float>(displayH)},
-      2.0f, Color{40, 40, 40, 255});
-
-  const char *jumpStatus = "IDLE";
-  if (game.player.dashTimer > 0.0f)
-    jumpStatus = "DASH";
-  else if (!game.player.grounded)
-    jumpStatus = "JUMPING";
-  else if (game.player.jumpBufferTimer > 0.0f)
-    jumpStatus = "READY";
-
+  const int rDisplayY = panelY + 15;
   const int statusW = MeasureText(jumpStatus, 20);
-  const int statusX = rDisplayX + (displayW - statusW) / 2;
+  const int statusX = rDisplayX + (kHudDisplayW - statusW) / 2;
   for (int i = 0; i < 3; ++i) {
     DrawText(jumpStatus, statusX + i, rDisplayY + 12 + i, 20,
              Color{0, 255, 100, static_cast<unsigned char>(60 / (i + 1))});
   }
   DrawText(jumpStatus, statusX, rDisplayY + 12, 20, Color{0, 255, 100, 255});
-  DrawText("JUMP-O MASTER", rightPanelX + 15, rightPanelY + 75, 12, pal.uiText);
 
   // ── Central gauge: O2 / FUEL / SPEED ─────────────────────────────────────
-  const int gaugeCX = centerX;
   const int gaugeCY = hudStartY + 60;
-  const float gaugeR = 55.0f;
   const int segCount = 24;
-
-  DrawCircleLines(gaugeCX, gaugeCY, gaugeR, Color{100, 100, 150, 255});
-  DrawCircleLines(gaugeCX, gaugeCY, gaugeR * 0.7f, Color{100, 100, 150, 255});
-
-  const float speedNorm = Clamp01(planarSpeed / cfg::kThrottleSpeedMax);
-  const float fuelNorm =
-      1.0f - (game.player.dashCooldownTimer / cfg::kDashCooldown);
-  const float o2Norm = Clamp01(game.runTime / 300.0f);
-
   const Color fillCol = Color{200, 100, 255, 255};
   const Color emptyCol = Color{40, 40, 80, 255};
 
-  DrawSegmentedGauge(gaugeCX, gaugeCY, gaugeR, segCount, speedNorm, fillCol,
-                     emptyCol);
-  DrawSegmentedGauge(gaugeCX, gaugeCY, gaugeR * 0.82f, segCount, fuelNorm,
-                     fillCol, emptyCol);
-  DrawSegmentedGauge(gaugeCX, gaugeCY, gaugeR * 0.64f, segCount, o2Norm,
-                     fillCol, emptyCol);
+  DrawSegmentedGauge(centerX, gaugeCY, kHudGaugeR, segCount,
+                     s.speedFill / kGaugeSteps, fillCol, emptyCol);
+  DrawSegmentedGauge(centerX, gaugeCY, kHudGaugeR * 0.82f, segCount,
+                     s.fuelFill / kGaugeSteps, fillCol, emptyCol);
+  DrawSegmentedGauge(centerX, gaugeCY, kHudGaugeR * 0.64f, segCount,
+                     s.o2Fill / kGaugeSteps, fillCol, emptyCol);
 
-  DrawText("O2", gaugeCX - 10, gaugeCY - 18, 14, pal.uiText);
-  DrawText("FUEL", gaugeCX - 18, gaugeCY - 3, 12, pal.uiText);
-  DrawText("SPEED", gaugeCX - 20, gaugeCY + 12, 12, pal.uiText);
+  DrawText("O2", centerX - 10, gaugeCY - 18, 14, pal.uiText);
+  DrawText("FUEL", centerX - 18, gaugeCY - 3, 12, pal.uiText);
+  DrawText("SPEED", centerX - 20, gaugeCY + 12, 12, pal.uiText);
 
   // ── Throttle bar ──────────────────────────────────────────────────────────
   const int throttleBarX = centerX - 150;
   const int throttleBarY = hudStartY + 140;
-  const int throttleBarW = 300;
   const int throttleBarH = 20;
-
-  DrawRectangle(throttleBarX, throttleBarY, throttleBarW, throttleBarH,
-                Color{20, 25, 30, 255});
-  DrawRectangleLinesEx(Rectangle{static_cast<float>(throttleBarX),
-                                 static_cast<float>(throttleBarY),
-                                 static_cast<float>(throttleBarW),
-                                 static_cast<float>(throttleBarH)},
-                       2.0f, Color{80, 90, 100, 255});
-
-  const int fillW = static_cast<int>(game.throttle * throttleBarW);
-  if (fillW > 0) {
-    DrawRectangle(throttleBarX, throttleBarY, fillW, throttleBarH,
+  if (s.throttleW > 0) {
+    DrawRectangle(throttleBarX, throttleBarY, s.throttleW, throttleBarH,
                   Color{200, 100, 255, 255});
-    DrawRectangle(throttleBarX, throttleBarY, fillW, throttleBarH / 3,
+    DrawRectangle(throttleBarX, throttleBarY, s.throttleW, throttleBarH / 3,
                   Color{255, 150, 255, 255});
     DrawRectangleLinesEx(Rectangle{static_cast<float>(throttleBarX),
                                    static_cast<float>(throttleBarY),
-                                   static_cast<float>(fillW),
+                                   static_cast<float>(s.throttleW),
                                    static_cast<float>(throttleBarH)},
                          1.0f, Color{255, 200, 255, 255});
   }
-  DrawText("THROTTLE", centerX - 35, throttleBarY - 18, 14, pal.uiText);
+}
 
-  // ── Side-panel decorative strips ─────────────────────────────────────────
-  DrawRectangle(0, hudStartY, 20, hudHeight, Color{40, 45, 50, 255});
-  DrawRectangle(cfg::kScreenWidth - 20, hudStartY, 20, hudHeight,
-                Color{40, 45, 50, 255});
-  for (int i = 0; i < 3; ++i) {
-    DrawRectangle(10 + i * 6, hudStartY + 10, 4, 4, Color{100, 120, 140, 255});
-    DrawRectangle(cfg::kScreenWidth - 14 - i * 6, hudStartY + 10, 4, 4,
-                  Color{100, 120, 140, 255});
+// ─── Backdrop cache
+// ─────────────────────────────────────────────────────────────
+//
+// The grid and the gradients over the background texture never scroll, so
+// they are composited once per style into a premultiplied-alpha texture.
+// Per frame the backdrop is one repeating-texture quad plus that overlay.
+
+static RenderTexture2D g_backdrop = {};
+static bool g_backdropValid = false;
+static bool g_backdropFailed = false;
+static BackdropStyle g_backdropStyle;
+
+static bool SameBackdrop(const BackdropStyle &a, const BackdropStyle &b) {
+  return PackColor(a.gridLine) == PackColor(b.gridLine) &&
+         PackColor(a.skyTop) == PackColor(b.skyTop) &&
+         PackColor(a.skyBottom) == PackColor(b.skyBottom) &&
+         PackColor(a.voidTint) == PackColor(b.voidTint) &&
+         a.bgHeight == b.bgHeight && a.skyHeight == b.skyHeight &&
+         a.alpha == b.alpha;
+}
+
+static void DrawBackdropLayers(const BackdropStyle &s) {
+  DrawGridOverlay(s.gridLine, cfg::kScreenWidth, s.bgHeight, s.alpha);
+  DrawRectangleGradientV(0, 0, cfg::kScreenWidth, s.bgHeight,
+                         Fade(BLACK, 0.0f), Fade(BLACK, 0.3f));
+
+  // Sky gradient, then the void tint over its lower half
+  DrawRectangleGradientV(0, 0, cfg::kScreenWidth, s.skyHeight,
+                         Fade(s.skyTop, 0.4f), Fade(s.skyBottom, 0.5f));
+  DrawRectangleGradientV(0, s.skyHeight / 2, cfg::kScreenWidth,
+                         s.skyHeight / 2, Fade(BLACK, 0.0f),
+                         Fade(s.voidTint, 0.3f));
+}
+
+// Rebuild the overlay if the style changed. False when render textures are
+// unavailable.
+static bool UpdateBackdropCache(const BackdropStyle &style) {
+  if (g_backdropFailed)
+    return false;
+  if (g_backdrop.id == 0) {
+    g_backdrop = LoadRenderTexture(cfg::kScreenWidth, cfg::kScreenHeight);
+    if (g_backdrop.id == 0) {
+      LOG_WARN("Backdrop: render texture unavailable, drawing directly");
+      g_backdropFailed = true;
+      return false;
+    }
+  }
+  if (g_backdropValid && SameBackdrop(g_backdropStyle, style))
+    return true;
+
+  // Colour is blended as usual but alpha accumulates as 1 - prod(1 - a), so
+  // the texture holds premultiplied colour for a single "over" later.
+  BeginCacheTexture(g_backdrop);
+  ClearBackground(BLANK);
+  rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE,
+                            RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+  BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+  DrawBackdropLayers(style);
+  EndBlendMode();
+  EndCacheTexture();
+
+  g_backdropStyle = style;
+  g_backdropValid = true;
+  return true;
+}
+
+// ─── Public functions
+// ─────────────────────────────────────────────────────────
+
+void DrawBackdrop(int textureIndex, float scrollOffset,
+                  const BackdropStyle &style) {
+  if (g_backgroundTexturesLoaded && textureIndex >= 0 && textureIndex < 4 &&
+      g_backgroundTextures[textureIndex].id != 0) {
+    // One quad; the texture repeats horizontally, scrolled by UV offset.
+    const Texture2D &tex = g_backgroundTextures[textureIndex];
+    const float texScale =
+        static_cast<float>(style.bgHeight) / static_cast<float>(tex.height);
+    const float texW = static_cast<float>(tex.width) * texScale;
+    const float scrollX = std::fmod(scrollOffset, texW);
+    DrawTexturePro(
+        tex,
+        Rectangle{-scrollX / texScale, 0.0f,
+                  static_cast<float>(cfg::kScreenWidth) / texScale,
+                  static_cast<float>(tex.height)},
+        Rectangle{0.0f, 0.0f, static_cast<float>(cfg::kScreenWidth),
+                  static_cast<float>(style.bgHeight)},
+        Vector2{0.0f, 0.0f}, 0.0f,
+        Color{255, 255, 255, static_cast<unsigned char>(255 * style.alpha)});
+  }
+
+  if (!UpdateBackdropCache(style)) {
+    DrawBackdropLayers(style);
+    return;
+  }
+  BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+  DrawTextureRec(g_backdrop.texture,
+                 Rectangle{0.0f, 0.0f, static_cast<float>(cfg::kScreenWidth),
+                           -static_cast<float>(cfg::kScreenHeight)},
+                 Vector2{0.0f, 0.0f}, WHITE);
+  EndBlendMode();
+}
+
+void UnloadBackdrop() {
+  if (g_backdrop.id != 0)
+    UnloadRenderTexture(g_backdrop);
+  g_backdrop = {};
+  g_backdropValid = false;
+  g_backdropFailed = false;
+}
+
+void RenderCockpitHUD(const Game &game, const LevelPalette &pal,
+                      float planarSpeed) {
+  const CockpitState state = MakeCockpitState(game, pal, planarSpeed);
+  if (!EnsureCockpitTargets()) {
+    DrawCockpitStatic(pal);
+    DrawCockpitDynamic(state, pal);
+    return;
+  }
+
+  const int hudStartY = cfg::kScreenHeight - g_hudFrame.texture.height;
+  if (!g_hudStaticValid || g_hudStaticText != state.uiText) {
+    BeginCockpitTarget(g_hudStatic, hudStartY);
+    DrawCockpitStatic(pal);
+    EndCockpitTarget();
+    g_hudStaticText = state.uiText;
+    g_hudStaticValid = true;
+    g_hudFrameValid = false;
+  }
+  if (!g_hudFrameValid || !(g_hudFrameState == state)) {
+    BeginCockpitTarget(g_hudFrame, hudStartY);
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawRenderTexture(g_hudStatic, hudStartY);
+    BeginLayerBlend();
+    DrawCockpitDynamic(state, pal);
+    EndCockpitTarget();
+    g_hudFrameState = state;
+    g_hudFrameValid = true;
+  }
+  BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+  DrawRenderTexture(g_hudFrame, hudStartY);
+  EndBlendMode();
+}
+
+void UnloadCockpitHUD() {
+  for (RenderTexture2D *target : {&g_hudStatic, &g_hudFrame, &g_digitAtlas}) {
+    if (target->id != 0)
+      UnloadRenderTexture(*target);
+    *target = {};
+  }
+  g_hudStaticValid = false;
+  g_hudFrameValid = false;
+  g_digitAtlasReady = false;
+  g_hudTargetsFailed = false;
+}
+
+void RenderPerfOverlay(const Game &game, const LevelPalette &pal) {
+  const perf::FrameHistory &history = game.frameHistory;
+  constexpr int kPanelW = perf::kFrameHistorySize + 40;
+  constexpr int kPanelH = 506;
+  constexpr int kGraphH = 60;
+  constexpr float kGraphMaxMs = 33.3f; // Two 60 Hz frames
+  const int panelX = cfg::kScreenWidth - kPanelW - 10;
+  const int panelY = 10;
+
+  DrawRectangleRounded({static_cast<float>(panelX), static_cast<float>(panelY),
+                        static_cast<float>(kPanelW),
+                        static_cast<float>(kPanelH)},
+                       0.05f, 8, Fade(pal.uiPanel, 0.92f));
+  DrawText("PERF (F4)", panelX + 10, panelY + 8, 14, pal.uiAccent);
+
+  char buf[128];
+  std::snprintf(buf, sizeof(buf), "%d play frames", history.count);
+  DrawText(buf, panelX + kPanelW - 10 - MeasureText(buf, 12), panelY + 10, 12,
+           Fade(pal.uiText, 0.7f));
+
+  // Percentile table
+  const int colX[5] = {panelX + 10, panelX + 76, panelX + 132, panelX + 188,
+                       panelX + 244};
+  int rowY = panelY + 30;
+  DrawText("ms", colX[0], rowY, 12, Fade(pal.uiText, 0.7f));
+  DrawText("p50", colX[1], rowY, 12, Fade(pal.uiText, 0.7f));
+  DrawText("p95", colX[2], rowY, 12, Fade(pal.uiText, 0.7f));
+  DrawText("p99", colX[3], rowY, 12, Fade(pal.uiText, 0.7f));
+  DrawText("max", colX[4], rowY, 12, Fade(pal.uiText, 0.7f));
+
+  struct Row {
+    const char *label;
+    float perf::FrameSample::*field;
+  };
+  const Row rows[4] = {{"Frame", &perf::FrameSample::frameMs},
+                       {"Sim", &perf::FrameSample::simMs},
+                       {"Render", &perf::FrameSample::renderMs},
+                       {"Jitter", &perf::FrameSample::pacerJitterMs}};
+  for (const Row &row : rows) {
+    rowY += 16;
+    const perf::FramePercentiles p =
+        perf::ComputeFramePercentiles(history, row.field);
+    DrawText(row.label, colX[0], rowY, 13, pal.uiText);
+    const float values[4] = {p.p50, p.p95, p.p99, p.max};
+    for (int i = 0; i < 4; ++i) {
+      std::snprintf(buf, sizeof(buf), "%.2f", values[i]);
+      DrawText(buf, colX[i + 1], rowY, 13, pal.uiText);
+    }
+  }
+
+  // Sim stepping
+  rowY += 22;
+  const int clampedInWindow = perf::CountClampedFrames(history);
+  std::snprintf(buf, sizeof(buf), "Sim steps/frame: %.2f avg",
+                perf::AverageSimSteps(history));
+  DrawText(buf, colX[0], rowY, 13, pal.uiText);
+  rowY += 16;
+  std::snprintf(buf, sizeof(buf), "Step clamp: %d in window, %llu total",
+                clampedInWindow,
+                static_cast<unsigned long long>(history.clampedFrames));
+  DrawText(buf, colX[0], rowY, 13,
+           clampedInWindow > 0 ? pal.uiAccent : pal.uiText);
+  rowY += 16;
+  std::snprintf(buf, sizeof(buf), "Update allocs: %d", game.updateAllocCount);
+  DrawText(buf, colX[0], rowY, 13,
+           game.updateAllocCount > 0 ? pal.uiAccent : pal.uiText);
+
+  // Cube batch: every instance used to be its own DrawCubeV call.
+  const CubeBatchStats &cubes = GetCubeBatchStats();
+  rowY += 16;
+  if (cubes.immediateCubes > 0) {
+    std::snprintf(buf, sizeof(buf), "Cubes: %d immediate (no instancing)",
+                  cubes.immediateCubes);
+  } else {
+    std::snprintf(buf, sizeof(buf), "Cubes: %d + %d wire in %d draws",
+                  cubes.solidCubes, cubes.wireCubes, cubes.drawCalls);
+  }
+  DrawText(buf, colX[0], rowY, 13, pal.uiText);
+  const PrefabStats &prefabs = GetPrefabStats();
+  rowY += 16;
+  if (prefabs.immediateVertices > 0) {
+    std::snprintf(buf, sizeof(buf), "Prefabs: %d immediate (%dk verts)",
+                  prefabs.instances, prefabs.immediateVertices / 1000);
+  } else {
+    std::snprintf(buf, sizeof(buf), "Prefabs: %d in %d draws, %d cached",
+                  prefabs.instances, prefabs.drawCalls, prefabs.prefabs);
+  }
+  DrawText(buf, colX[0], rowY, 13, pal.uiText);
+  const CullStats &cull = GetCullStats();
+  rowY += 16;
+  std::snprintf(buf, sizeof(buf), "Culling: %d drawn, %d culled",
+                cull.tested - cull.culled, cull.culled);
+  DrawText(buf, colX[0], rowY, 13, pal.uiText);
+  const LodStats &lod = GetLodStats();
+  rowY += 16;
+  std::snprintf(buf, sizeof(buf), "LOD: %d full, %d reduced, %d minimal",
+                lod.objects[0], lod.objects[1], lod.objects[2]);
+  DrawText(buf, colX[0], rowY, 13, pal.uiText);
+  const core::ParticleStats burst = game.particles.Stats();
+  const core::ParticleStats exhaust = GetExhaustParticleStats();
+  rowY += 16;
+  std::snprintf(buf, sizeof(buf), "Particles: burst %d/%d, exhaust %d/%d",
+                burst.live, burst.capacity, exhaust.live, exhaust.capacity);
+  DrawText(buf, colX[0], rowY, 13,
+           burst.dropped + exhaust.dropped > 0 ? pal.uiAccent : pal.uiText);
+  const LevelMeshStats &levelMesh = GetLevelMeshStats();
+  const EndlessMeshStats &endlessMesh = GetEndlessMeshStats();
+  rowY += 16;
+  if (game.isEndlessMode) {
+    std::snprintf(buf, sizeof(buf),
+                  "Endless mesh: %d live, %d pending, %.2f ms upload",
+                  endlessMesh.liveChunks, endlessMesh.pendingChunks,
+                  endlessMesh.uploadMs);
+  } else if (levelMesh.chunkCount > 0) {
+    const LevelPreloadStats &preload = GetLevelPreloadStats();
+    std::snprintf(buf, sizeof(buf),
+                  "Level mesh: %d/%d chunks, %dk verts, preload %d/%d",
+                  levelMesh.drawnChunks, levelMesh.chunkCount,
+                  levelMesh.vertexCount / 1000, preload.hits,
+                  preload.hits + preload.misses);
+  } else {
+    std::snprintf(buf, sizeof(buf), "Level mesh: not baked");
+  }
+  DrawText(buf, colX[0], rowY, 13, pal.uiText);
+
+  // Frame pacer
+  const core::FramePacer &pacer = game.framePacer;
+  rowY += 16;
+  if (pacer.targetFps > 0) {
+    std::snprintf(buf, sizeof(buf), "Pacer (F5): %d fps  spin %.2f ms",
+                  pacer.targetFps, pacer.spinMarginMs);
+  } else {
+    std::snprintf(buf, sizeof(buf), "Pacer (F5): uncapped");
+  }
+  DrawText(buf, colX[0], rowY, 13, pal.uiText);
+  rowY += 16;
+  std::snprintf(buf, sizeof(buf), "Missed deadlines: %llu",
+                pacer.missedDeadlines);
+  DrawText(buf, colX[0], rowY, 13, pal.uiText);
+
+  // GPU submissions per pass, last frame
+  rowY += 22;
+  if (!DrawStatsAvailable()) {
+    DrawText("Draw stats: no GL hooks in this build", colX[0], rowY, 13,
+             Fade(pal.uiText, 0.7f));
+  } else {
+    DrawText("pass", colX[0], rowY, 12, Fade(pal.uiText, 0.7f));
+    DrawText("draws", colX[1], rowY, 12, Fade(pal.uiText, 0.7f));
+    DrawText("flush", colX[2], rowY, 12, Fade(pal.uiText, 0.7f));
+    DrawText("verts", colX[3], rowY, 12, Fade(pal.uiText, 0.7f));
+    DrawText("state", colX[4], rowY, 12, Fade(pal.uiText, 0.7f));
+    const DrawStats &draws = GetDrawStats();
+    for (int i = 0; i <= kDrawPassCount; ++i) {
+      const bool total = i == kDrawPassCount;
+      const PassDrawStats &p = total ? draws.total : draws.passes[i];
+      const Color color = total ? pal.uiAccent : pal.uiText;
+      rowY += 14;
+      DrawText(total ? "Total" : DrawPassName(static_cast<DrawPass>(i)),
+               colX[0], rowY, 12, color);
+      std::snprintf(buf, sizeof(buf), "%d", p.drawCalls);
+      DrawText(buf, colX[1], rowY, 12, color);
+      std::snprintf(buf, sizeof(buf), "%d", p.batchFlushes);
+      DrawText(buf, colX[2], rowY, 12, color);
+      std::snprintf(buf, sizeof(buf), "%.1fk",
+                    static_cast<float>(p.vertices) / 1000.0f);
+      DrawText(buf, colX[3], rowY, 12, color);
+      std::snprintf(buf, sizeof(buf), "%d", p.stateChanges);
+      DrawText(buf, colX[4], rowY, 12, color);
+    }
+  }
+
+  // Frame-time graph, oldest on the left. Reference lines at 120/60 Hz.
+  const int graphX = panelX + 20;
+  const int graphY = panelY + kPanelH - kGraphH - 10;
+  DrawRectangle(graphX, graphY, perf::kFrameHistorySize, kGraphH,
+                Fade(BLACK, 0.35f));
+  const auto msToY = [&](float ms) {
+    const float t = render::Clamp01(ms / kGraphMaxMs);
+    return graphY + kGraphH - static_cast<int>(t * kGraphH);
+  };
+  const int firstX = graphX + perf::kFrameHistorySize - history.count;
+  for (int i = 0; i < history.count; ++i) {
+    const perf::FrameSample &s = perf::GetFrameSample(history, i);
+    const Color c = s.simClamped             ? RED
+                    : (s.frameMs > 16.7f)    ? pal.uiAccent
+                                             : Fade(pal.uiText, 0.8f);
+    DrawLine(firstX + i, graphY + kGraphH, firstX + i, msToY(s.frameMs), c);
   }
+  DrawLine(graphX, msToY(8.33f), graphX + perf::kFrameHistorySize,
+           msToY(8.33f), Fade(GREEN, 0.6f));
+  DrawLine(graphX, msToY(16.67f), graphX + perf::kFrameHistorySize,
+           msToY(16.67f), Fade(YELLOW, 0.6f));
 }
 
 } // namespace render
@@ -7,14 +7,39 @@ struct LevelPalette;
 
 namespace render {
 
-// Draw a scrolling background texture with a grid overlay.
-// `textureIndex` selects from the loaded background textures (-1 = grid only).
-void DrawBackgroundWithGrid(int textureIndex, float scrollOffset,
-                            const LevelPalette &pal, int width, int height,
-                            float alpha = 1.0f);
+// Static layers over the scrolling background: the grid and darkening over
+// the background area, then the sky and void gradients over the 3D view.
+struct BackdropStyle {
+  Color gridLine;
+  Color skyTop;
+  Color skyBottom;
+  Color voidTint;
+  int bgHeight = 0;   // Background texture and grid
+  int skyHeight = 0;  // Sky gradients
+  float alpha = 1.0f; // Background texture and grid opacity
+};
+
+// Draw the scrolling background texture and the backdrop layers at full
+// screen width. `textureIndex` selects from the loaded background textures
+// (-1 = layers only). The layers are cached per style in a render texture.
+void DrawBackdrop(int textureIndex, float scrollOffset,
+                  const BackdropStyle &style);
+
+// Free the backdrop cache. Renderer shutdown only.
+void UnloadBackdrop();
 
 // Draw the full retro cockpit HUD (bottom-third panel) during gameplay.
+// The panel is cached in render textures and only re-rendered when one of
+// the displayed values changes; see HudWidgets.cpp.
 void RenderCockpitHUD(const Game &game, const LevelPalette &pal,
                       float planarSpeed);
 
+// Free the cockpit render textures. Renderer shutdown only.
+void UnloadCockpitHUD();
+
+// Draw the detailed perf overlay (F4): timing percentiles, sim step stats
+// and a frame-time graph from game.frameHistory, which only holds frames
+// spent playing.
+void RenderPerfOverlay(const Game &game, const LevelPalette &pal);
+
 } // namespace render
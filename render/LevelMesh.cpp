@@ -0,0 +1,315 @@
+#include "render/LevelMesh.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "core/Config.hpp"
+#include "core/Log.hpp"
+#include "render/LevelPreload.hpp"
+#include "render/Palette.hpp"
+#include "render/RenderUtils.hpp"
+#include "sim/Level.hpp"
+
+namespace render {
+
+namespace {
+
+struct LevelChunk {
+  Model model = {};
+  float minZ = 0.0f;
+  float maxZ = 0.0f;
+};
+
+const Level *g_bakedLevel = nullptr;
+int g_bakedPalette = -1;
+bool g_bakeFailed = false;
+std::vector<LevelChunk> g_chunks;
+LevelMeshStats g_stats;
+
+void PushVertex(MeshBuilder &b, const Vector3 &p, Color c) {
+  b.vertices.insert(b.vertices.end(), {p.x, p.y, p.z});
+  b.colors.insert(b.colors.end(), {c.r, c.g, c.b, c.a});
+}
+
+// Two CCW triangles for a quad whose corners are CCW seen from outside.
+void PushQuad(MeshBuilder &b, const Vector3 &a, const Vector3 &c1,
+              const Vector3 &c2, const Vector3 &d, Color col) {
+  PushVertex(b, a, col);
+  PushVertex(b, c1, col);
+  PushVertex(b, c2, col);
+  PushVertex(b, a, col);
+  PushVertex(b, c2, col);
+  PushVertex(b, d, col);
+}
+
+void ExtendZ(MeshBuilder &b, float z0, float z1) {
+  if (b.vertices.empty()) {
+    b.minZ = z0;
+    b.maxZ = z1;
+  } else {
+    b.minZ = std::min(b.minZ, z0);
+    b.maxZ = std::max(b.maxZ, z1);
+  }
+}
+
+void UnloadChunks() {
+  for (LevelChunk &chunk : g_chunks) {
+    if (chunk.model.meshCount > 0)
+      UnloadModel(chunk.model);
+  }
+  g_chunks.clear();
+  g_stats = {};
+}
+
+} // namespace
+
+// ─── Segment style
+// ────────────────────────────────────────────────────────────
+
+SegmentStyle GetSegmentStyle(const LevelSegment &seg, const LevelPalette &pal) {
+  SegmentStyle style;
+
+  // Safety check: if heightScale is negative (unassigned), use default value
+  const float effectiveHeightScale =
+      (seg.heightScale < 0.0f) ? 1.0f : seg.heightScale;
+  style.visualHeight = cfg::kPlatformHeight * effectiveHeightScale;
+
+  // Safety check: clamp colorTint to valid range (0-2)
+  const int safeColorTint =
+      (seg.colorTint < 0) ? 0 : (seg.colorTint > 2 ? 2 : seg.colorTint);
+  style.side = ApplyColorTint(pal.platformSide, safeColorTint);
+  style.top = ApplyColorTint(pal.platformTop, safeColorTint);
+  style.wire = ApplyColorTint(pal.platformWire, safeColorTint);
+  style.neonEdge = pal.neonEdge;
+  style.neonGlow = pal.neonEdgeGlow;
+
+  // Safety check: clamp variantIndex to valid range (0-7)
+  const int safeVariantIndex =
+      (seg.variantIndex < 0) ? 0
+                             : (seg.variantIndex > 7 ? 7 : seg.variantIndex);
+  switch (safeVariantIndex) {
+  case 1:
+    style.wireAlpha = 0.3f;
+    break;
+  case 2:
+    style.wireAlpha = 0.7f;
+    break;
+  case 3:
+    style.side = ApplyColorTint(pal.platformSide, 1);
+    break;
+  case 4:
+    style.side = Color{static_cast<unsigned char>(style.side.r * 0.8f),
+                       static_cast<unsigned char>(style.side.g * 0.8f),
+                       static_cast<unsigned char>(style.side.b * 0.8f), 255};
+    break;
+  case 5:
+    style.glowIntensity = 0.3f;
+    style.neonEdge = Color{
+        static_cast<unsigned char>(std::min(255, pal.neonEdge.r + 40)),
+        static_cast<unsigned char>(std::min(255, pal.neonEdge.g + 40)),
+        static_cast<unsigned char>(std::min(255, pal.neonEdge.b + 40)), 255};
+    break;
+  case 6:
+    style.wireAlpha = 0.0f;
+    style.drawGrid = false;
+    style.side = Color{static_cast<unsigned char>(style.side.r * 0.7f),
+                       static_cast<unsigned char>(style.side.g * 0.7f),
+                       static_cast<unsigned char>(style.side.b * 0.7f), 255};
+    break;
+  case 7:
+    style.striped = true;
+    break;
+  default:
+    break;
+  }
+  return style;
+}
+
+// ─── Mesh building
+// ────────────────────────────────────────────────────────────
+
+void MeshBuilder::Clear() {
+  vertices.clear();
+  colors.clear();
+  minZ = maxZ = 0.0f;
+}
+
+void MeshBuilder::AddBox(Vector3 c, Vector3 s, Color color) {
+  const float hx = s.x * 0.5f;
+  const float hy = s.y * 0.5f;
+  const float hz = s.z * 0.5f;
+  ExtendZ(*this, c.z - hz, c.z + hz);
+  const Vector3 p[8] = {
+      {c.x - hx, c.y - hy, c.z - hz}, {c.x + hx, c.y - hy, c.z - hz},
+      {c.x + hx, c.y + hy, c.z - hz}, {c.x - hx, c.y + hy, c.z - hz},
+      {c.x - hx, c.y - hy, c.z + hz}, {c.x + hx, c.y - hy, c.z + hz},
+      {c.x + hx, c.y + hy, c.z + hz}, {c.x - hx, c.y + hy, c.z + hz},
+  };
+  // +Z, -Z, +X, -X, +Y, -Y; corners CCW seen from outside.
+  static constexpr int kFaces[6][4] = {{4, 5, 6, 7}, {1, 0, 3, 2},
+                                       {5, 1, 2, 6}, {0, 4, 7, 3},
+                                       {3, 7, 6, 2}, {0, 1, 5, 4}};
+  for (const auto &f : kFaces)
+    PushQuad(*this, p[f[0]], p[f[1]], p[f[2]], p[f[3]], color);
+}
+
+void MeshBuilder::AddFlatQuad(Vector3 c, float sizeX, float sizeZ,
+                              Color color) {
+  const float hx = sizeX * 0.5f;
+  const float hz = sizeZ * 0.5f;
+  ExtendZ(*this, c.z - hz, c.z + hz);
+  PushQuad(*this, {c.x - hx, c.y, c.z - hz}, {c.x - hx, c.y, c.z + hz},
+           {c.x + hx, c.y, c.z + hz}, {c.x + hx, c.y, c.z - hz}, color);
+}
+
+void AppendSegmentGeometry(MeshBuilder &builder, const LevelSegment &seg,
+                           const SegmentStyle &style, const LevelPalette &pal) {
+  const float segMidZ = seg.startZ + seg.length * 0.5f;
+  const float halfW = seg.width * 0.5f;
+  const float visualH = style.visualHeight;
+
+  builder.AddBox({seg.xOffset, seg.topY - visualH * 0.5f, segMidZ},
+                 {seg.width, visualH, seg.length}, style.side);
+  builder.AddBox({seg.xOffset, seg.topY - 0.01f, segMidZ},
+                 {seg.width, 0.02f, seg.length}, style.top);
+
+  const float leftEdge = seg.xOffset - halfW;
+  const float rightEdge = seg.xOffset + halfW;
+  const float edgeY = seg.topY + cfg::kNeonEdgeHeight * 0.5f;
+  const Vector3 edgeSize = {cfg::kNeonEdgeWidth, cfg::kNeonEdgeHeight,
+                            seg.length};
+  const Vector3 edgeGlowSize = {cfg::kNeonEdgeWidth * 3.0f,
+                                cfg::kNeonEdgeHeight * 2.5f, seg.length};
+  const Color glow = Fade(style.neonGlow, style.glowIntensity);
+  builder.AddBox({leftEdge, edgeY, segMidZ}, edgeSize, style.neonEdge);
+  builder.AddBox({rightEdge, edgeY, segMidZ}, edgeSize, style.neonEdge);
+  builder.AddBox({leftEdge, edgeY, segMidZ}, edgeGlowSize, glow);
+  builder.AddBox({rightEdge, edgeY, segMidZ}, edgeGlowSize, glow);
+
+  if (style.striped) {
+    constexpr int stripeCount = 8;
+    for (int st = 0; st < stripeCount; ++st) {
+      const float t = static_cast<float>(st) / static_cast<float>(stripeCount);
+      const Color sc =
+          (st % 2 == 0) ? style.top : ApplyColorTint(style.top, 1);
+      builder.AddBox(
+          {seg.xOffset, seg.topY + 0.01f, seg.startZ + t * seg.length},
+          {seg.width, 0.015f, seg.length / stripeCount}, Fade(sc, 0.6f));
+    }
+  }
+
+  // Longitudinal grid lines become thin quads; the lateral lines scroll with
+  // the player and stay dynamic.
+  if (style.drawGrid) {
+    const float sGuideY = seg.topY + 0.02f;
+    const Color gridCol = Fade(pal.gridLine, 0.3f);
+    for (int gi = 0; gi < cfg::kGridLongitudinalCount; ++gi) {
+      const float t = static_cast<float>(gi) /
+                      static_cast<float>(cfg::kGridLongitudinalCount - 1);
+      const float gx = seg.xOffset - halfW + t * seg.width;
+      builder.AddFlatQuad({gx, sGuideY, segMidZ}, cfg::kBakedGridLineWidth,
+                          seg.length, gridCol);
+    }
+  }
+}
+
+Model UploadMeshBuilder(MeshBuilder &builder) {
+  if (builder.vertices.empty())
+    return Model{};
+
+  Mesh mesh = {};
+  mesh.vertexCount = builder.VertexCount();
+  mesh.triangleCount = mesh.vertexCount / 3;
+  mesh.vertices = builder.vertices.data();
+  mesh.colors = builder.colors.data();
+  UploadMesh(&mesh, false);
+
+  // The GPU has its copy; keep UnloadModel away from the builder's storage.
+  mesh.vertices = nullptr;
+  mesh.colors = nullptr;
+  return LoadModelFromMesh(mesh);
+}
+
+void BuildLevelChunks(const Level &level, const LevelPalette &pal,
+                      std::vector<MeshBuilder> &chunks) {
+  chunks.clear();
+  if (level.segmentCount == 0)
+    return;
+
+  // Segments are stored in Z order; start a new chunk once the current one
+  // spans cfg::kLevelMeshChunkLength.
+  MeshBuilder builder;
+  float chunkStartZ = level.segments[0].startZ;
+  const auto flush = [&]() {
+    if (builder.vertices.empty())
+      return;
+    chunks.push_back(std::move(builder));
+    builder = MeshBuilder{};
+  };
+  for (int si = 0; si < level.segmentCount; ++si) {
+    const LevelSegment &seg = level.segments[si];
+    if (seg.startZ - chunkStartZ >= cfg::kLevelMeshChunkLength) {
+      flush();
+      chunkStartZ = seg.startZ;
+    }
+    AppendSegmentGeometry(builder, seg, GetSegmentStyle(seg, pal), pal);
+  }
+  flush();
+}
+
+// ─── Level cache
+// ──────────────────────────────────────────────────────────────
+
+bool EnsureLevelMesh(const Level &level, const LevelPalette &pal,
+                     int paletteIndex) {
+  if (g_bakedLevel == &level && g_bakedPalette == paletteIndex)
+    return !g_bakeFailed;
+
+  UnloadChunks();
+  g_bakedLevel = &level;
+  g_bakedPalette = paletteIndex;
+  g_bakeFailed = !IsWindowReady() || level.segmentCount == 0;
+  if (g_bakeFailed)
+    return false;
+
+  // Only the upload has to happen here; the vertex data is usually ready.
+  std::vector<MeshBuilder> builders;
+  const bool preloaded = TakePreloadedLevelMesh(level, paletteIndex, builders);
+  if (!preloaded)
+    BuildLevelChunks(level, pal, builders);
+  for (MeshBuilder &builder : builders) {
+    LevelChunk chunk;
+    chunk.minZ = builder.minZ;
+    chunk.maxZ = builder.maxZ;
+    g_stats.vertexCount += builder.VertexCount();
+    chunk.model = UploadMeshBuilder(builder);
+    g_chunks.push_back(chunk);
+  }
+
+  g_stats.chunkCount = static_cast<int>(g_chunks.size());
+  LOG_INFO("Baked level mesh{}: {} segments -> {} chunks, {} vertices",
+           preloaded ? " (preloaded)" : "", level.segmentCount,
+           g_stats.chunkCount, g_stats.vertexCount);
+  return true;
+}
+
+void UnloadLevelMesh() {
+  UnloadChunks();
+  g_bakedLevel = nullptr;
+  g_bakedPalette = -1;
+  g_bakeFailed = false;
+}
+
+void DrawLevelMesh(float viewZ, float drawDistance) {
+  g_stats.drawnChunks = 0;
+  for (const LevelChunk &chunk : g_chunks) {
+    if (chunk.maxZ < viewZ - drawDistance || chunk.minZ > viewZ + drawDistance)
+      continue;
+    DrawModel(chunk.model, {0.0f, 0.0f, 0.0f}, 1.0f, WHITE);
+    ++g_stats.drawnChunks;
+  }
+}
+
+const LevelMeshStats &GetLevelMeshStats() { return g_stats; }
+
+} // namespace render
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <vector>
+
+#include <raylib.h>
+
+struct Level;
+struct LevelPalette;
+struct LevelSegment;
+
+// Static level geometry baked into GPU meshes.
+//
+// Built-in levels never change once GetLevelByIndex has resolved them, so
+// their segment bodies, top plates, neon edges, stripes and longitudinal grid
+// lines are baked once per (level, palette) into Models split into Z chunks.
+// RenderFrame then draws only the chunks within view distance. Segment
+// wireframes and the animated lateral grid stay dynamic.
+
+namespace render {
+
+// Resolved visual style of one segment (variant, tint and height applied).
+struct SegmentStyle {
+  Color side = {};
+  Color top = {};
+  Color wire = {};
+  Color neonEdge = {};
+  Color neonGlow = {};
+  float wireAlpha = 0.5f;
+  float glowIntensity = 0.15f;
+  float visualHeight = 1.0f;
+  bool drawGrid = true;
+  bool striped = false;
+};
+
+SegmentStyle GetSegmentStyle(const LevelSegment &seg, const LevelPalette &pal);
+
+// CPU-side triangle soup with per-vertex colours, ready for UploadMesh.
+struct MeshBuilder {
+  std::vector<float> vertices;       // xyz per vertex
+  std::vector<unsigned char> colors; // rgba per vertex
+  float minZ = 0.0f;
+  float maxZ = 0.0f;
+
+  void Clear();
+  int VertexCount() const { return static_cast<int>(vertices.size() / 3); }
+  void AddBox(Vector3 center, Vector3 size, Color color);
+  void AddFlatQuad(Vector3 center, float sizeX, float sizeZ, Color color);
+};
+
+// Append the static parts of one segment (everything but wireframes and the
+// lateral grid) in the same order RenderFrame used to draw them.
+void AppendSegmentGeometry(MeshBuilder &builder, const LevelSegment &seg,
+                           const SegmentStyle &style, const LevelPalette &pal);
+
+// Upload `builder` as a Model. Returns a model with meshCount == 0 if empty.
+Model UploadMeshBuilder(MeshBuilder &builder);
+
+// CPU half of a bake: `level`'s static geometry, one builder per Z chunk of
+// about cfg::kLevelMeshChunkLength. Needs no GL context, so render/LevelPreload
+// runs it on a worker thread.
+void BuildLevelChunks(const Level &level, const LevelPalette &pal,
+                      std::vector<MeshBuilder> &chunks);
+
+struct LevelMeshStats {
+  int chunkCount = 0;
+  int drawnChunks = 0; // Last DrawLevelMesh call
+  int vertexCount = 0;
+};
+
+// Bake `level` with `pal` unless that combination is already cached, using
+// chunks render/LevelPreload built ahead of time when it has them.
+// Returns false if nothing could be baked (no GL context, empty level).
+bool EnsureLevelMesh(const Level &level, const LevelPalette &pal,
+                     int paletteIndex);
+
+// Drop the cached bake (renderer shutdown, or a level edited in place).
+void UnloadLevelMesh();
+
+// Draw every chunk overlapping [viewZ - drawDistance, viewZ + drawDistance].
+void DrawLevelMesh(float viewZ, float drawDistance);
+
+const LevelMeshStats &GetLevelMeshStats();
+
+} // namespace render
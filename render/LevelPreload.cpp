@@ -0,0 +1,200 @@
+#include "render/LevelPreload.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+#include "core/Config.hpp"
+#include "core/Log.hpp"
+#include "core/PerfTracker.hpp"
+#include "render/LevelMesh.hpp"
+#include "render/Palette.hpp"
+#include "sim/Level.hpp"
+
+namespace render {
+
+namespace {
+
+// Free and Ready slots belong to the main thread, Queued and Building ones
+// to the worker. Each hand-over is a release store matched by an acquire
+// load on the other side.
+enum class SlotState : uint8_t { Free, Queued, Building, Ready };
+
+struct PreloadSlot {
+  std::atomic<SlotState> state{SlotState::Free};
+
+  // Written by the main thread while the slot is Free.
+  int levelIndex = 0;
+  int paletteIndex = -1;
+  uint32_t stamp = 0;      // Request order; the oldest Ready slot is evicted
+  uint32_t generation = 0; // Preloader generation when requested
+
+  // Written by the worker while the slot is Building.
+  const Level *level = nullptr;
+  std::vector<MeshBuilder> chunks;
+  float buildMs = 0.0f;
+};
+
+struct Preloader {
+  PreloadSlot slots[cfg::kLevelPreloadSlots];
+  std::atomic<uint32_t> wakeups{0}; // Bumped to wake the worker
+  std::atomic<bool> stopping{false};
+
+  // Main thread only.
+  std::thread worker;
+  uint32_t nextStamp = 0;
+  uint32_t generation = 0; // Bumped by InvalidateLevelPreloads
+  int lastTakenIndex = 0;  // Its mesh is live in render/LevelMesh
+  int lastTakenPalette = -1;
+  LevelPreloadStats stats;
+};
+
+Preloader g_preloader;
+
+void BuildSlot(PreloadSlot &slot) {
+  using Clock = std::chrono::steady_clock;
+  const auto start = Clock::now();
+  // The first resolve opens and validates the level pack; do that here too.
+  slot.level = &GetLevelByIndex(slot.levelIndex);
+  BuildLevelChunks(*slot.level, GetPalette(slot.paletteIndex), slot.chunks);
+  slot.buildMs =
+      std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+}
+
+void WorkerMain() {
+  perf::AllocScope allocScope(perf::AllocTag::Render);
+  Preloader &p = g_preloader;
+  for (;;) {
+    const uint32_t seen = p.wakeups.load(std::memory_order_acquire);
+    if (p.stopping.load(std::memory_order_acquire))
+      return;
+    bool built = false;
+    for (PreloadSlot &slot : p.slots) {
+      SlotState expected = SlotState::Queued;
+      if (!slot.state.compare_exchange_strong(expected, SlotState::Building,
+                                              std::memory_order_acquire))
+        continue;
+      BuildSlot(slot);
+      slot.state.store(SlotState::Ready, std::memory_order_release);
+      built = true;
+    }
+    // Sleep until the main thread queues more; returns at once if it
+    // already has since `seen` was read.
+    if (!built)
+      p.wakeups.wait(seen, std::memory_order_acquire);
+  }
+}
+
+void ResetSlots() {
+  for (PreloadSlot &slot : g_preloader.slots) {
+    slot.chunks.clear();
+    slot.level = nullptr;
+    slot.levelIndex = 0;
+    slot.paletteIndex = -1;
+    slot.state.store(SlotState::Free, std::memory_order_relaxed);
+  }
+}
+
+} // namespace
+
+void PreloadLevel(int levelIndex, int paletteIndex) {
+  Preloader &p = g_preloader;
+  if (levelIndex < 1 || levelIndex > 30)
+    return;
+  if (levelIndex == p.lastTakenIndex && paletteIndex == p.lastTakenPalette)
+    return;
+
+  PreloadSlot *freeSlot = nullptr;
+  PreloadSlot *oldestReady = nullptr;
+  for (PreloadSlot &slot : p.slots) {
+    const SlotState state = slot.state.load(std::memory_order_acquire);
+    const bool stale = slot.generation != p.generation;
+    if (state == SlotState::Free || (state == SlotState::Ready && stale)) {
+      if (!freeSlot)
+        freeSlot = &slot;
+      continue;
+    }
+    if (!stale && slot.levelIndex == levelIndex &&
+        slot.paletteIndex == paletteIndex)
+      return;
+    if (state == SlotState::Ready &&
+        (!oldestReady || slot.stamp < oldestReady->stamp))
+      oldestReady = &slot;
+  }
+
+  PreloadSlot *slot = freeSlot ? freeSlot : oldestReady;
+  if (!slot) {
+    ++p.stats.dropped;
+    return;
+  }
+  slot->chunks.clear();
+  slot->level = nullptr;
+  slot->levelIndex = levelIndex;
+  slot->paletteIndex = paletteIndex;
+  slot->stamp = p.nextStamp++;
+  slot->generation = p.generation;
+  slot->state.store(SlotState::Queued, std::memory_order_release);
+  ++p.stats.requested;
+
+  if (!p.worker.joinable()) {
+    p.stopping.store(false, std::memory_order_relaxed);
+    p.worker = std::thread(WorkerMain);
+  }
+  p.wakeups.fetch_add(1, std::memory_order_release);
+  p.wakeups.notify_one();
+}
+
+bool TakePreloadedLevelMesh(const Level &level, int paletteIndex,
+                            std::vector<MeshBuilder> &chunks) {
+  Preloader &p = g_preloader;
+  for (PreloadSlot &slot : p.slots) {
+    if (slot.state.load(std::memory_order_acquire) != SlotState::Ready ||
+        slot.generation != p.generation || slot.level != &level ||
+        slot.paletteIndex != paletteIndex)
+      continue;
+    chunks = std::move(slot.chunks);
+    slot.chunks.clear();
+    p.lastTakenIndex = slot.levelIndex;
+    p.lastTakenPalette = slot.paletteIndex;
+    p.stats.lastBuildMs = slot.buildMs;
+    ++p.stats.hits;
+    slot.state.store(SlotState::Free, std::memory_order_relaxed);
+    return true;
+  }
+  // Whatever gets baked now replaces the mesh of the last preload taken.
+  p.lastTakenIndex = 0;
+  p.lastTakenPalette = -1;
+  ++p.stats.misses;
+  return false;
+}
+
+void InvalidateLevelPreloads() {
+  // Queued and Building slots belong to the worker; they come back Ready
+  // with the old generation and are reused like free ones.
+  Preloader &p = g_preloader;
+  ++p.generation;
+  p.lastTakenIndex = 0;
+  p.lastTakenPalette = -1;
+}
+
+void ShutdownLevelPreloader() {
+  Preloader &p = g_preloader;
+  if (p.worker.joinable()) {
+    p.stopping.store(true, std::memory_order_release);
+    p.wakeups.fetch_add(1, std::memory_order_release);
+    p.wakeups.notify_one();
+    p.worker.join();
+    LOG_INFO("Level preloader: {} requested, {} hits, {} misses",
+             p.stats.requested, p.stats.hits, p.stats.misses);
+  }
+  ResetSlots();
+  p.lastTakenIndex = 0;
+  p.lastTakenPalette = -1;
+  p.stats = {};
+}
+
+const LevelPreloadStats &GetLevelPreloadStats() { return g_preloader.stats; }
+
+} // namespace render
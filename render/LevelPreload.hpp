@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vector>
+
+struct Level;
+
+// Background preloading of built-in level meshes.
+//
+// Starting a level used to resolve it (level pack or embedded data) and
+// build every chunk of its static mesh on the main thread in the first
+// frame of the run. The renderer instead asks for the levels the player is
+// likely to start next (the next level of the stage during a run, the
+// hovered entry on the level select screen); a worker thread resolves them
+// and builds their MeshBuilders into a small ready cache, and
+// EnsureLevelMesh is left with just the GPU upload.
+//
+// Each cache slot is owned by one side at a time, tracked by an atomic state:
+// the main thread fills Free slots and publishes them as Queued, the worker
+// builds Queued slots and publishes them as Ready, and the main thread takes
+// or evicts Ready slots. The main thread never takes a lock or waits on the
+// worker.
+
+namespace render {
+
+struct MeshBuilder;
+
+struct LevelPreloadStats {
+  int requested = 0;   // Preloads queued
+  int dropped = 0;     // Requests with every slot queued or building
+  int hits = 0;        // Bakes served from the cache
+  int misses = 0;      // Bakes built on the main thread
+  float lastBuildMs = 0.0f; // Worker time of the last taken preload
+};
+
+// Main thread. Queue `levelIndex` (1-30) for building with `paletteIndex`.
+// Cheap when it is already queued, ready or the last level taken.
+void PreloadLevel(int levelIndex, int paletteIndex);
+
+// Main thread. Move the chunks preloaded for `level` and `paletteIndex` into
+// `chunks` and free their slot. False when they aren't ready (yet).
+bool TakePreloadedLevelMesh(const Level &level, int paletteIndex,
+                            std::vector<MeshBuilder> &chunks);
+
+// Main thread. Forget everything built or queued so far; levels requested
+// again are rebuilt from what GetLevelByIndex returns now (level hot reload).
+void InvalidateLevelPreloads();
+
+// Stop the worker thread and drop the cache. Renderer shutdown only.
+void ShutdownLevelPreloader();
+
+const LevelPreloadStats &GetLevelPreloadStats();
+
+} // namespace render
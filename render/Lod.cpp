@@ -0,0 +1,63 @@
+#include "render/Lod.hpp"
+
+#include <cmath>
+
+#include "core/Config.hpp"
+
+namespace render {
+
+namespace {
+
+Vector3 g_eye = {};
+float g_pixelsPerUnit = 0.0f; // At unit distance; 0 = orthographic
+LodStats g_stats;
+
+// Diameter below which each coarser tier starts, finest first.
+constexpr float kThresholds[kLodTierCount - 1] = {cfg::kLodReducedPx,
+                                                  cfg::kLodMinimalPx};
+
+} // namespace
+
+void BeginLodFrame(const Camera3D &camera, float viewportHeight) {
+  g_eye = camera.position;
+  g_pixelsPerUnit =
+      camera.projection == CAMERA_PERSPECTIVE
+          ? viewportHeight / std::tan(camera.fovy * DEG2RAD * 0.5f) * 0.5f
+          : 0.0f;
+  g_stats = {};
+}
+
+float ProjectedDiameter(Vector3 center, float radius) {
+  const float dx = center.x - g_eye.x;
+  const float dy = center.y - g_eye.y;
+  const float dz = center.z - g_eye.z;
+  const float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+  if (g_pixelsPerUnit <= 0.0f || dist <= radius)
+    return INFINITY;
+  return 2.0f * radius * g_pixelsPerUnit / dist;
+}
+
+LodTier SelectLod(float diameterPx) {
+  int tier = 0;
+  while (tier < kLodTierCount - 1 && diameterPx < kThresholds[tier])
+    ++tier;
+  return static_cast<LodTier>(tier);
+}
+
+LodTier SelectLod(float diameterPx, LodTier previous) {
+  int tier = static_cast<int>(previous);
+  // Coarsen only once well below a threshold, refine only once well above.
+  while (tier < kLodTierCount - 1 &&
+         diameterPx < kThresholds[tier] * (1.0f - cfg::kLodHysteresis))
+    ++tier;
+  while (tier > 0 &&
+         diameterPx > kThresholds[tier - 1] * (1.0f + cfg::kLodHysteresis))
+    --tier;
+  return static_cast<LodTier>(tier);
+}
+
+void CountLod(LodTier tier) { ++g_stats.objects[static_cast<int>(tier)]; }
+
+const LodStats &GetLodStats() { return g_stats; }
+
+} // namespace render
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+
+#include <raylib.h>
+
+// Distance-based level of detail for the world renderers.
+//
+// Each object picks a detail tier from the projected diameter of its
+// bounding sphere, so the same obstacle drops detail sooner when the camera
+// widens its field of view at speed. Tiers switch at cfg::kLodReducedPx and
+// cfg::kLodMinimalPx; an object only leaves its current tier once it is
+// cfg::kLodHysteresis past a threshold, so objects sitting on a boundary
+// don't pop back and forth. Renderers keep the previous tier per object in
+// a LodState.
+
+namespace render {
+
+enum class LodTier : uint8_t { Full, Reduced, Minimal };
+constexpr int kLodTierCount = 3;
+
+struct LodStats {
+  int objects[kLodTierCount] = {}; // Per tier, this frame
+};
+
+// This frame's camera and the height in pixels the 3D projection maps to.
+// Resets LodStats.
+void BeginLodFrame(const Camera3D &camera, float viewportHeight);
+
+// Diameter in pixels of a sphere under this frame's camera. Orthographic
+// cameras and spheres around the eye count as arbitrarily large.
+float ProjectedDiameter(Vector3 center, float radius);
+
+// Tier for a projected diameter. The first form has no history; the second
+// stays at `previous` until the size clears the hysteresis band.
+LodTier SelectLod(float diameterPx);
+LodTier SelectLod(float diameterPx, LodTier previous);
+
+// Count an object drawn at `tier` towards LodStats.
+void CountLod(LodTier tier);
+const LodStats &GetLodStats();
+
+// Previous tier per object slot. `key` identifies the object living in a
+// slot (its z, say); when it changes the slot starts over without history.
+template <int Capacity> struct LodState {
+  LodTier tier[Capacity] = {};
+  float key[Capacity] = {};
+  bool valid[Capacity] = {};
+
+  LodTier Select(int id, float objectKey, Vector3 center, float radius) {
+    const float px = ProjectedDiameter(center, radius);
+    const bool known = valid[id] && key[id] == objectKey;
+    tier[id] = known ? SelectLod(px, tier[id]) : SelectLod(px);
+    key[id] = objectKey;
+    valid[id] = true;
+    CountLod(tier[id]);
+    return tier[id];
+  }
+};
+
+} // namespace render
@@ -0,0 +1,406 @@
+#include "render/PowerUpRenderer.hpp"
+
+#include <cmath>
+
+#include "core/Config.hpp"
+#include "render/FrameTarget.hpp"
+#include "render/Frustum.hpp"
+#include "render/Lod.hpp"
+#include "render/Prefab.hpp"
+#include "render/RenderUtils.hpp"
+#include "sim/Level.hpp"
+#include "sim/PowerUp.hpp"
+
+namespace render {
+
+namespace {
+
+enum class IconShape { Cube, Sphere, Pyramid, Cylinder };
+
+struct PowerUpLook {
+  Color body;
+  Color glow;
+  Color ring; // Very bright, for rings and sparkles
+  float iconSize;
+  IconShape shape;
+};
+
+// Indexed by PowerUpType; the last entry covers anything unknown.
+constexpr int kLookCount = 8;
+constexpr PowerUpLook kLooks[kLookCount] = {
+    // Shield: bright cyan
+    {{100, 220, 255, 255}, {150, 240, 255, 255}, {200, 250, 255, 255}, 0.7f,
+     IconShape::Sphere},
+    // ScoreMultiplier: bright green
+    {{100, 255, 180, 255}, {150, 255, 220, 255}, {200, 255, 240, 255}, 0.65f,
+     IconShape::Cylinder},
+    // SpeedBoostShield: bright purple
+    {{220, 150, 255, 255}, {240, 180, 255, 255}, {250, 220, 255, 255}, 0.75f,
+     IconShape::Pyramid},
+    // SpeedBoostGhost: bright orange
+    {{255, 220, 100, 255}, {255, 240, 150, 255}, {255, 250, 200, 255}, 0.7f,
+     IconShape::Sphere},
+    // ObstacleReveal: bright yellow
+    {{255, 255, 120, 255}, {255, 255, 200, 255}, {255, 255, 240, 255}, 0.65f,
+     IconShape::Cylinder},
+    // SpeedDrain: bright red
+    {{255, 100, 100, 255}, {255, 180, 180, 255}, {255, 220, 220, 255}, 0.7f,
+     IconShape::Pyramid},
+    // ObstacleSurge: bright orange-red
+    {{255, 140, 0, 255}, {255, 200, 100, 255}, {255, 230, 150, 255}, 0.75f,
+     IconShape::Sphere},
+    // Unknown
+    {{200, 200, 200, 255}, {220, 220, 220, 255}, {240, 240, 240, 255}, 0.6f,
+     IconShape::Cube},
+};
+
+// Vertex groups of a power-up prefab; see UpdateGroups for their motion.
+enum Group : int {
+  kRingOuter,
+  kRingInner,
+  kGlowOuter,
+  kGlowMiddle,
+  kGlowCore,
+  kIcon,
+  kPedestal,
+  kBeam,
+  kSparkle0,
+  kGroupCount = kSparkle0 + 8,
+};
+static_assert(kGroupCount <= kPrefabMaxGroups, "too many prefab groups");
+
+constexpr int kSparkleCount = kGroupCount - kSparkle0;
+constexpr float kLift = 0.2f; // Icon centre above the ground
+
+// Strong pulsing glow: 0.7 + 0.3 * sin(3.5 t)
+constexpr PrefabPulse kGlowPulse = {3.5f, 0.0f, 0.7f, 0.3f};
+
+// Label text colours, indexed like kLooks.
+constexpr Color kLabelColors[kLookCount] = {
+    {100, 200, 255, 255}, {100, 255, 150, 255}, {200, 150, 255, 255},
+    {255, 200, 100, 255}, {255, 255, 100, 255}, {255, 80, 80, 255},
+    {255, 120, 0, 255},   {200, 200, 200, 255},
+};
+
+// Labels are rendered once at the largest pulsed size (18 * 1.15) and
+// scaled down per frame.
+constexpr int kLabelFontSize = 20;
+constexpr int kLabelOutline = 2;
+
+struct LabelTexture {
+  RenderTexture2D target = {};
+  int width = 0;
+  int height = 0;
+};
+
+// One prefab per look and detail tier.
+bool g_built[kLookCount][kLodTierCount] = {};
+Prefab g_prefabs[kLookCount][kLodTierCount];
+PrefabInstance g_instances[kLookCount][kLodTierCount][kMaxPowerUps];
+int g_instanceCounts[kLookCount][kLodTierCount] = {};
+LodState<kMaxPowerUps> g_lod;
+bool g_labelsReady = false;
+LabelTexture g_labels[kLookCount];
+
+int LookIndex(PowerUpType type) {
+  const int t = static_cast<int>(type);
+  return (t >= 0 && t < kLookCount - 1) ? t : kLookCount - 1;
+}
+
+// Geometry at scalePulse = 1, centred on the icon. Reduced detail drops the
+// two large glow shells and the sparkles; Minimal keeps the icon body, one
+// glow box and the beam.
+PrefabBuilder BuildPowerUp(const PowerUpLook &look, LodTier tier) {
+  PrefabBuilder b;
+  const float s = look.iconSize;
+  const Vector3 origin = {0.0f, 0.0f, 0.0f};
+  const bool full = tier == LodTier::Full;
+  const bool minimal = tier == LodTier::Minimal;
+
+  // Rotating rings (multiple layers for dramatic effect)
+  if (!minimal) {
+    b.AddBox(origin, {s * 1.8f, 0.1f, s * 1.8f}, look.ring, {}, kRingOuter);
+    b.AddBox(origin, {s * 1.8f * 1.1f, 0.05f, s * 1.8f * 1.1f},
+             Fade(look.ring, 0.6f), {}, kRingOuter);
+    b.AddBox(origin, {s * 1.5f, 0.08f, s * 1.5f}, Fade(look.ring, 0.9f), {},
+             kRingInner);
+  }
+
+  // Multi-layer glow; outer and middle shells also breathe in size
+  if (full) {
+    b.AddBox(origin, {s, s, s}, Fade(look.glow, 0.7f), kGlowPulse,
+             kGlowOuter);
+    b.AddBox(origin, {s, s, s}, Fade(look.glow, 0.8f), kGlowPulse,
+             kGlowMiddle);
+  }
+  if (!minimal) {
+    b.AddBox(origin, {s * 1.6f, s * 1.6f, s * 1.6f}, Fade(look.glow, 0.9f),
+             kGlowPulse, kGlowCore);
+  }
+  b.AddBox(origin, {s * 1.2f, s * 1.2f, s * 1.2f}, look.glow, {}, kGlowCore);
+
+  // Main icon with distinct shapes (fully opaque, no wireframes). The first
+  // box of each is the body; the rest is detail.
+  switch (look.shape) {
+  case IconShape::Sphere:
+  case IconShape::Cube:
+    b.AddBox(origin, {s, s, s}, look.body, {}, kIcon);
+    if (minimal)
+      break;
+    b.AddBox({0.0f, s * 0.3f, -s * 0.3f}, {s * 0.4f, s * 0.4f, s * 0.4f},
+             Color{255, 255, 255, 200}, {}, kIcon);
+    break;
+  case IconShape::Pyramid:
+    b.AddBox({0.0f, -s * 0.3f, 0.0f}, {s, s * 0.6f, s}, look.body, {}, kIcon);
+    if (minimal)
+      break;
+    b.AddBox({0.0f, s * 0.2f, 0.0f}, {s * 0.5f, s * 0.4f, s * 0.5f},
+             look.glow, {}, kIcon);
+    b.AddBox({0.0f, s * 0.25f, -s * 0.2f}, {s * 0.3f, s * 0.2f, s * 0.3f},
+             Color{255, 255, 255, 180}, {}, kIcon);
+    break;
+  case IconShape::Cylinder:
+    b.AddBox(origin, {s, s * 0.8f, s}, look.body, {}, kIcon);
+    if (minimal)
+      break;
+    b.AddBox({0.0f, s * 0.35f, 0.0f}, {s * 0.9f, s * 0.2f, s * 0.9f},
+             look.glow, {}, kIcon);
+    b.AddBox({0.0f, -s * 0.35f, 0.0f}, {s * 0.9f, s * 0.2f, s * 0.9f},
+             look.glow, {}, kIcon);
+    b.AddBox({0.0f, s * 0.3f, -s * 0.3f}, {s * 0.5f, s * 0.15f, s * 0.5f},
+             Color{255, 255, 255, 200}, {}, kIcon);
+    break;
+  }
+
+  // Glowing base/pedestal on the ground
+  if (!minimal) {
+    b.AddBox(origin, {s * 1.2f, 0.1f, s * 1.2f}, Fade(look.glow, 0.8f),
+             kGlowPulse, kPedestal);
+  }
+
+  // Vertical glow beam (makes them stand out even more)
+  b.AddBox({0.0f, s * 0.4f, 0.0f}, {s * 0.3f, s * 0.8f, s * 0.3f},
+           Fade(look.glow, 0.5f), kGlowPulse, kBeam);
+
+  // Particle sparkles (unit cubes, placed and sized per frame)
+  for (int i = 0; full && i < kSparkleCount; ++i)
+    b.AddBox(origin, {1.0f, 1.0f, 1.0f}, Fade(look.ring, 0.9f), {},
+             kSparkle0 + i);
+  return b;
+}
+
+void UpdateGroups(PrefabGroup (&groups)[kGroupCount], const PowerUpLook &look,
+                  float simTime) {
+  // Scale pulsing animation (breathing effect)
+  const float scalePulse = 1.0f + 0.15f * std::sin(simTime * 2.5f);
+  const float glowPulse = 0.7f + 0.3f * std::sin(simTime * 3.5f);
+
+  for (PrefabGroup &g : groups)
+    g = {};
+
+  // Fast rotation and counter-rotation; ring thickness does not breathe
+  groups[kRingOuter].scale = scalePulse;
+  groups[kRingOuter].yawRad = simTime * 60.0f * DEG2RAD;
+  groups[kRingInner].scale = scalePulse;
+  groups[kRingInner].yawRad = simTime * -45.0f * DEG2RAD;
+
+  const float outer = scalePulse * (2.8f + 0.5f * glowPulse);
+  const float middle = scalePulse * (2.2f + 0.3f * glowPulse);
+  groups[kGlowOuter].scale = groups[kGlowOuter].scaleY = outer;
+  groups[kGlowMiddle].scale = groups[kGlowMiddle].scaleY = middle;
+  groups[kGlowCore].scale = groups[kGlowCore].scaleY = scalePulse;
+
+  // Slow spin on top of each power-up's own rotation
+  const float iconYaw = simTime * 30.0f * DEG2RAD;
+  for (Group id : {kIcon, kPedestal, kBeam}) {
+    groups[id].scale = scalePulse;
+    groups[id].scaleY = scalePulse;
+    groups[id].yawRad = iconYaw;
+    groups[id].instanceYaw = 1.0f;
+  }
+  groups[kPedestal].scaleY = 1.0f;
+  groups[kPedestal].offset = {0.0f, -kLift + 0.05f, 0.0f};
+  // The beam has always been lifted by the icon's height above the origin.
+  groups[kBeam].instanceY = 1.0f;
+
+  const float sparkleRadius = look.iconSize * scalePulse * 1.3f;
+  for (int i = 0; i < kSparkleCount; ++i) {
+    const float angle =
+        simTime * 2.0f + static_cast<float>(i) * (2.0f * kPi / kSparkleCount);
+    const float size = 0.08f + 0.05f * std::sin(simTime * 5.0f + i);
+    PrefabGroup &g = groups[kSparkle0 + i];
+    g.offset = {std::cos(angle) * sparkleRadius,
+                0.3f + 0.2f * std::sin(simTime * 4.0f + i),
+                std::sin(angle) * sparkleRadius};
+    g.scale = g.scaleY = size;
+  }
+}
+
+// Outline (every offset within kLabelOutline) then fill, at `fontSize`.
+void DrawOutlinedLabel(const char *label, int x, int y, int fontSize,
+                       Color color) {
+  for (int ox = -kLabelOutline; ox <= kLabelOutline; ++ox) {
+    for (int oy = -kLabelOutline; oy <= kLabelOutline; ++oy) {
+      if (ox != 0 || oy != 0)
+        DrawText(label, x + ox, y + oy, fontSize, BLACK);
+    }
+  }
+  DrawText(label, x, y, fontSize, color);
+}
+
+} // namespace
+
+void RenderPowerUps(const Level &level, const Vector3 &playerRenderPos,
+                    float simTime) {
+  for (auto &counts : g_instanceCounts) {
+    for (int &count : counts)
+      count = 0;
+  }
+
+  SphereBatch<kMaxPowerUps> bounds;
+  for (int pi = 0; pi < level.powerUpCount; ++pi) {
+    const auto &pu = level.powerUps[pi];
+    if (!pu.active)
+      continue;
+    if (std::fabs(pu.z - playerRenderPos.z) > 60.0f)
+      continue;
+
+    // Stationary position on ground (no bobbing). The bounds cover the
+    // outer glow and sparkles; the beam sits a further renderY up.
+    const Vector3 pos = {pu.x, pu.groundY + kLift, pu.z};
+    bounds.Add(pi, pos, 2.0f + std::fabs(pos.y));
+  }
+  bounds.Cull();
+
+  for (int k = 0; k < bounds.count; ++k) {
+    if (!bounds.visible[k])
+      continue;
+    const auto &pu = level.powerUps[bounds.id[k]];
+    const Vector3 pos = {bounds.x[k], bounds.y[k], bounds.z[k]};
+    const int look = LookIndex(pu.type);
+    const int tier = static_cast<int>(
+        g_lod.Select(bounds.id[k], pu.z, pos, bounds.r[k]));
+    g_instances[look][tier][g_instanceCounts[look][tier]++] = {
+        pos, pu.rotation * DEG2RAD};
+  }
+
+  PrefabGroup groups[kGroupCount];
+  for (int look = 0; look < kLookCount; ++look) {
+    bool animated = false;
+    for (int tier = 0; tier < kLodTierCount; ++tier) {
+      const int count = g_instanceCounts[look][tier];
+      if (count == 0)
+        continue;
+      if (!g_built[look][tier]) {
+        g_prefabs[look][tier] = LoadPrefab(
+            BuildPowerUp(kLooks[look], static_cast<LodTier>(tier)));
+        g_built[look][tier] = true;
+      }
+      if (!animated) {
+        UpdateGroups(groups, kLooks[look], simTime);
+        animated = true;
+      }
+      DrawPrefab(g_prefabs[look][tier], groups, kGroupCount,
+                 g_instances[look][tier], count, simTime);
+    }
+  }
+}
+
+void UnloadPowerUpPrefabs() {
+  for (int look = 0; look < kLookCount; ++look) {
+    for (int tier = 0; tier < kLodTierCount; ++tier) {
+      if (g_built[look][tier])
+        UnloadPrefab(g_prefabs[look][tier]);
+      g_built[look][tier] = false;
+    }
+  }
+}
+
+// ─── Labels
+// ───────────────────────────────────────────────────────────────────
+
+void InitPowerUpLabels() {
+  if (g_labelsReady)
+    return;
+
+  for (int look = 0; look < kLookCount; ++look) {
+    const PowerUpType type = static_cast<PowerUpType>(look);
+    const char *label = GetPowerUpLabel(type);
+    if (look == kLookCount - 1 || !label || label[0] == '\0')
+      continue;
+
+    LabelTexture &tex = g_labels[look];
+    tex.width = MeasureText(label, kLabelFontSize) + 2 * kLabelOutline;
+    tex.height = kLabelFontSize + 2 * kLabelOutline;
+    tex.target = LoadRenderTexture(tex.width, tex.height);
+    if (tex.target.id == 0) {
+      tex = {};
+      continue;
+    }
+    SetTextureFilter(tex.target.texture, TEXTURE_FILTER_BILINEAR);
+    BeginCacheTexture(tex.target);
+    ClearBackground(BLANK);
+    DrawOutlinedLabel(label, kLabelOutline, kLabelOutline, kLabelFontSize,
+                      kLabelColors[look]);
+    EndCacheTexture();
+  }
+  g_labelsReady = true;
+}
+
+void UnloadPowerUpLabels() {
+  for (LabelTexture &tex : g_labels) {
+    if (tex.target.id != 0)
+      UnloadRenderTexture(tex.target);
+    tex = {};
+  }
+  g_labelsReady = false;
+}
+
+void RenderPowerUpLabels(const Level &level, const Camera3D &camera,
+                         const Vector3 &playerRenderPos, float simTime) {
+  const float textPulse =
+      1.0f + 0.15f * std::sin(simTime * cfg::kPowerUpTextPulseSpeed);
+  const int fontSize = static_cast<int>(18.0f * textPulse);
+  const float scale =
+      static_cast<float>(fontSize) / static_cast<float>(kLabelFontSize);
+
+  for (int pi = 0; pi < level.powerUpCount; ++pi) {
+    const auto &pu = level.powerUps[pi];
+    if (!pu.active)
+      continue;
+    if (std::fabs(pu.z - playerRenderPos.z) > 60.0f)
+      continue;
+
+    const char *label = GetPowerUpLabel(pu.type);
+    if (!label || label[0] == '\0')
+      continue;
+
+    // Directly above the icon, in front of the camera and on screen
+    const Vector3 textPos = {pu.x, pu.groundY + kLift + 0.8f, pu.z};
+    const Vector2 screenPos = GetWorldToScreen(textPos, camera);
+    if (screenPos.x < 0 || screenPos.x >= cfg::kScreenWidth ||
+        screenPos.y < 0 || screenPos.y >= cfg::kScreenHeight ||
+        textPos.z <= playerRenderPos.z - 5.0f)
+      continue;
+
+    const int x = static_cast<int>(screenPos.x);
+    const int y = static_cast<int>(screenPos.y);
+    const int look = LookIndex(pu.type);
+    const LabelTexture &tex = g_labels[look];
+    if (tex.target.id == 0) {
+      DrawOutlinedLabel(label, x, y, fontSize, kLabelColors[look]);
+      continue;
+    }
+
+    // Render textures are stored upside down.
+    const float pad = kLabelOutline * scale;
+    DrawTexturePro(tex.target.texture,
+                   Rectangle{0.0f, 0.0f, static_cast<float>(tex.width),
+                             -static_cast<float>(tex.height)},
+                   Rectangle{x - pad, y - pad, tex.width * scale,
+                             tex.height * scale},
+                   Vector2{0.0f, 0.0f}, 0.0f, WHITE);
+  }
+}
+
+} // namespace render
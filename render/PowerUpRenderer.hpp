@@ -0,0 +1,29 @@
+#pragma once
+
+#include <raylib.h>
+
+struct Level;
+
+namespace render {
+
+// Draw every active power-up near the player: rotating rings, layered glow,
+// the type-specific icon, pedestal, beam and orbiting sparkles. Each type is
+// a cached prefab per detail tier (render/Lod), drawn with one instanced
+// call per tier in use.
+void RenderPowerUps(const Level &level, const Vector3 &playerRenderPos,
+                    float simTime);
+
+// Free the cached prefabs. Renderer shutdown only.
+void UnloadPowerUpPrefabs();
+
+// Pre-render every GetPowerUpLabel string with its outline into a texture.
+// Needs a GL context; safe to call more than once.
+void InitPowerUpLabels();
+void UnloadPowerUpLabels();
+
+// 2D pass: the pulsing type label above each active power-up near the
+// player, one textured quad per label. Call outside BeginMode3D.
+void RenderPowerUpLabels(const Level &level, const Camera3D &camera,
+                         const Vector3 &playerRenderPos, float simTime);
+
+} // namespace render
@@ -0,0 +1,300 @@
+#include "render/Prefab.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "core/Config.hpp"
+#include "core/Log.hpp"
+#include "raymath.h"
+#include "rlgl.h"
+
+namespace render {
+
+namespace {
+
+// ─── Shaders
+// ──────────────────────────────────────────────────────────────────
+
+// Same yaw convention as the cube batch and rlRotatef(yaw, 0, 1, 0).
+const char *kPrefabVs = R"(#version 330
+in vec3 vertexPosition;
+in vec4 vertexColor;
+in vec4 vertexPulse; // freq, phase, base, amp
+in float vertexGroup;
+in vec4 instancePose; // xyz = position, w = yaw
+uniform mat4 mvp;
+uniform float time;
+uniform vec4 groupXform[16]; // xyz = offset, w = scale
+uniform vec4 groupSpin[16];  // yaw, instance yaw, instance Y, scaleY
+out vec4 fragColor;
+void main() {
+  int g = int(vertexGroup + 0.5);
+  vec4 xf = groupXform[g];
+  vec4 spin = groupSpin[g];
+  float yaw = spin.x + spin.y * instancePose.w;
+  float c = cos(yaw);
+  float s = sin(yaw);
+  vec3 p = vertexPosition * vec3(xf.w, spin.w, xf.w);
+  p = vec3(c * p.x + s * p.z, p.y, -s * p.x + c * p.z) + xf.xyz;
+  p.y += spin.z * instancePose.y;
+  float pulse =
+      vertexPulse.z + vertexPulse.w * sin(vertexPulse.x * time + vertexPulse.y);
+  fragColor = vec4(vertexColor.rgb, clamp(vertexColor.a * pulse, 0.0, 1.0));
+  gl_Position = mvp * vec4(p + instancePose.xyz, 1.0);
+}
+)";
+
+const char *kPrefabFs = R"(#version 330
+in vec4 fragColor;
+out vec4 finalColor;
+void main() { finalColor = fragColor; }
+)";
+
+// ─── State
+// ────────────────────────────────────────────────────────────────────
+
+bool g_ready = false;
+Shader g_shader = {};
+int g_mvpLoc = -1;
+int g_timeLoc = -1;
+int g_groupXformLoc = -1;
+int g_groupSpinLoc = -1;
+int g_positionAttrib = -1;
+int g_colorAttrib = -1;
+int g_pulseAttrib = -1;
+int g_groupAttrib = -1;
+int g_instanceAttrib = -1;
+unsigned int g_instanceVbo = 0;
+PrefabStats g_stats;
+
+static_assert(sizeof(PrefabInstance) == 16, "instance layout must stay packed");
+
+void DrawImmediate(const Prefab &prefab, const PrefabGroup *groups,
+                   int groupCount, const PrefabInstance &instance,
+                   float time) {
+  const PrefabBuilder &cpu = prefab.cpu;
+  const PrefabGroup identity;
+  rlBegin(RL_TRIANGLES);
+  for (int v = 0; v < prefab.vertexCount; ++v) {
+    const int g = static_cast<int>(cpu.groups[v] + 0.5f);
+    const PrefabGroup &group = g < groupCount ? groups[g] : identity;
+    const float *pos = &cpu.mesh.vertices[v * 3];
+    const unsigned char *col = &cpu.mesh.colors[v * 4];
+    const float *pulse = &cpu.pulses[v * 4];
+    const float alpha =
+        col[3] * PrefabPulseAlpha({pulse[0], pulse[1], pulse[2], pulse[3]},
+                                  time);
+    const Vector3 p =
+        PrefabVertexPosition(group, instance, {pos[0], pos[1], pos[2]});
+    rlColor4ub(col[0], col[1], col[2],
+               static_cast<unsigned char>(std::clamp(alpha, 0.0f, 255.0f)));
+    rlVertex3f(p.x, p.y, p.z);
+  }
+  rlEnd();
+  g_stats.immediateVertices += prefab.vertexCount;
+}
+
+} // namespace
+
+// ─── Builder
+// ──────────────────────────────────────────────────────────────────
+
+void PrefabBuilder::Clear() {
+  mesh.Clear();
+  pulses.clear();
+  groups.clear();
+}
+
+void PrefabBuilder::AddBox(Vector3 center, Vector3 size, Color color,
+                           const PrefabPulse &pulse, int group) {
+  const int before = mesh.VertexCount();
+  mesh.AddBox(center, size, color);
+  for (int v = before; v < mesh.VertexCount(); ++v) {
+    pulses.insert(pulses.end(), {pulse.freq, pulse.phase, pulse.base,
+                                 pulse.amp});
+    groups.push_back(static_cast<float>(group));
+  }
+}
+
+Vector3 PrefabVertexPosition(const PrefabGroup &group,
+                             const PrefabInstance &instance, Vector3 vertex) {
+  const float yaw = group.yawRad + group.instanceYaw * instance.yawRad;
+  const float c = std::cos(yaw);
+  const float s = std::sin(yaw);
+  const Vector3 p = {vertex.x * group.scale, vertex.y * group.scaleY,
+                     vertex.z * group.scale};
+  return {instance.position.x + c * p.x + s * p.z + group.offset.x,
+          instance.position.y + p.y + group.offset.y +
+              group.instanceY * instance.position.y,
+          instance.position.z - s * p.x + c * p.z + group.offset.z};
+}
+
+float PrefabPulseAlpha(const PrefabPulse &pulse, float time) {
+  return pulse.base + pulse.amp * std::sin(pulse.freq * time + pulse.phase);
+}
+
+// ─── Lifetime
+// ─────────────────────────────────────────────────────────────────
+
+void InitPrefabs() {
+  if (g_ready)
+    return;
+
+  g_shader = LoadShaderFromMemory(kPrefabVs, kPrefabFs);
+  if (g_shader.id == 0 || g_shader.id == rlGetShaderIdDefault()) {
+    LOG_WARN("Prefabs: shader unavailable, using immediate mode");
+    return;
+  }
+  g_mvpLoc = GetShaderLocation(g_shader, "mvp");
+  g_timeLoc = GetShaderLocation(g_shader, "time");
+  g_groupXformLoc = GetShaderLocation(g_shader, "groupXform");
+  g_groupSpinLoc = GetShaderLocation(g_shader, "groupSpin");
+  g_positionAttrib = GetShaderLocationAttrib(g_shader, "vertexPosition");
+  g_colorAttrib = GetShaderLocationAttrib(g_shader, "vertexColor");
+  g_pulseAttrib = GetShaderLocationAttrib(g_shader, "vertexPulse");
+  g_groupAttrib = GetShaderLocationAttrib(g_shader, "vertexGroup");
+  g_instanceAttrib = GetShaderLocationAttrib(g_shader, "instancePose");
+  if (g_positionAttrib < 0 || g_colorAttrib < 0 || g_pulseAttrib < 0 ||
+      g_groupAttrib < 0 || g_instanceAttrib < 0) {
+    LOG_WARN("Prefabs: missing shader attributes, using immediate mode");
+    UnloadShader(g_shader);
+    g_shader = {};
+    return;
+  }
+
+  g_instanceVbo = rlLoadVertexBuffer(
+      nullptr,
+      static_cast<int>(sizeof(PrefabInstance)) * cfg::kPrefabInstanceCapacity,
+      true);
+  g_ready = true;
+}
+
+void CleanupPrefabs() {
+  if (!g_ready)
+    return;
+  rlUnloadVertexBuffer(g_instanceVbo);
+  UnloadShader(g_shader);
+  g_instanceVbo = 0;
+  g_shader = {};
+  g_ready = false;
+}
+
+Prefab LoadPrefab(PrefabBuilder &&builder) {
+  Prefab prefab;
+  prefab.cpu = std::move(builder);
+  prefab.vertexCount = prefab.cpu.VertexCount();
+  ++g_stats.prefabs;
+  if (!g_ready || prefab.vertexCount == 0)
+    return prefab;
+
+  const PrefabBuilder &cpu = prefab.cpu;
+  const int n = prefab.vertexCount;
+  prefab.vao = rlLoadVertexArray();
+  rlEnableVertexArray(prefab.vao);
+
+  prefab.vbos[0] = rlLoadVertexBuffer(
+      cpu.mesh.vertices.data(), n * 3 * static_cast<int>(sizeof(float)), false);
+  rlSetVertexAttribute(g_positionAttrib, 3, RL_FLOAT, false, 0, 0);
+  rlEnableVertexAttribute(g_positionAttrib);
+
+  prefab.vbos[1] = rlLoadVertexBuffer(cpu.mesh.colors.data(), n * 4, false);
+  rlSetVertexAttribute(g_colorAttrib, 4, RL_UNSIGNED_BYTE, true, 0, 0);
+  rlEnableVertexAttribute(g_colorAttrib);
+
+  prefab.vbos[2] = rlLoadVertexBuffer(
+      cpu.pulses.data(), n * 4 * static_cast<int>(sizeof(float)), false);
+  rlSetVertexAttribute(g_pulseAttrib, 4, RL_FLOAT, false, 0, 0);
+  rlEnableVertexAttribute(g_pulseAttrib);
+
+  prefab.vbos[3] = rlLoadVertexBuffer(
+      cpu.groups.data(), n * static_cast<int>(sizeof(float)), false);
+  rlSetVertexAttribute(g_groupAttrib, 1, RL_FLOAT, false, 0, 0);
+  rlEnableVertexAttribute(g_groupAttrib);
+
+  // Every prefab reads its instances from the shared buffer.
+  rlEnableVertexBuffer(g_instanceVbo);
+  rlSetVertexAttribute(g_instanceAttrib, 4, RL_FLOAT, false,
+                       static_cast<int>(sizeof(PrefabInstance)), 0);
+  rlEnableVertexAttribute(g_instanceAttrib);
+  rlSetVertexAttributeDivisor(g_instanceAttrib, 1);
+
+  rlDisableVertexBuffer();
+  rlDisableVertexArray();
+  return prefab;
+}
+
+void UnloadPrefab(Prefab &prefab) {
+  if (prefab.vao != 0) {
+    for (unsigned int vbo : prefab.vbos)
+      rlUnloadVertexBuffer(vbo);
+    rlUnloadVertexArray(prefab.vao);
+  }
+  if (g_stats.prefabs > 0)
+    --g_stats.prefabs;
+  prefab = {};
+}
+
+// ─── Drawing
+// ──────────────────────────────────────────────────────────────────
+
+void DrawPrefab(const Prefab &prefab, const PrefabGroup *groups,
+                int groupCount, const PrefabInstance *instances, int count,
+                float time) {
+  if (prefab.vertexCount == 0 || count <= 0)
+    return;
+  groupCount = std::min(groupCount, kPrefabMaxGroups);
+  g_stats.instances += count;
+
+  if (prefab.vao == 0) {
+    for (int i = 0; i < count; ++i)
+      DrawImmediate(prefab, groups, groupCount, instances[i], time);
+    return;
+  }
+
+  float xform[kPrefabMaxGroups * 4];
+  float spin[kPrefabMaxGroups * 4];
+  const PrefabGroup identity;
+  for (int g = 0; g < kPrefabMaxGroups; ++g) {
+    const PrefabGroup &group = g < groupCount ? groups[g] : identity;
+    float *x = &xform[g * 4];
+    float *s = &spin[g * 4];
+    x[0] = group.offset.x;
+    x[1] = group.offset.y;
+    x[2] = group.offset.z;
+    x[3] = group.scale;
+    s[0] = group.yawRad;
+    s[1] = group.instanceYaw;
+    s[2] = group.instanceY;
+    s[3] = group.scaleY;
+  }
+
+  // Emit pending immediate-mode geometry first so draw order is preserved.
+  rlDrawRenderBatchActive();
+  rlEnableShader(g_shader.id);
+  rlSetUniformMatrix(g_mvpLoc, MatrixMultiply(rlGetMatrixModelview(),
+                                              rlGetMatrixProjection()));
+  rlSetUniform(g_timeLoc, &time, SHADER_UNIFORM_FLOAT, 1);
+  rlSetUniform(g_groupXformLoc, xform, SHADER_UNIFORM_VEC4, kPrefabMaxGroups);
+  rlSetUniform(g_groupSpinLoc, spin, SHADER_UNIFORM_VEC4, kPrefabMaxGroups);
+  rlEnableVertexArray(prefab.vao);
+  for (int first = 0; first < count; first += cfg::kPrefabInstanceCapacity) {
+    const int n = std::min(count - first, cfg::kPrefabInstanceCapacity);
+    rlUpdateVertexBuffer(g_instanceVbo, instances + first,
+                         n * static_cast<int>(sizeof(PrefabInstance)), 0);
+    rlDrawVertexArrayInstanced(0, prefab.vertexCount, n);
+    ++g_stats.drawCalls;
+  }
+  rlDisableVertexArray();
+  rlDisableShader();
+}
+
+void ResetPrefabStats() {
+  const int live = g_stats.prefabs;
+  g_stats = {};
+  g_stats.prefabs = live;
+}
+
+const PrefabStats &GetPrefabStats() { return g_stats; }
+
+} // namespace render
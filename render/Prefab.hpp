@@ -0,0 +1,98 @@
+#pragma once
+
+#include <vector>
+
+#include <raylib.h>
+
+#include "render/LevelMesh.hpp"
+
+// Cached multi-part meshes for gates and power-up icons.
+//
+// A prefab is built once from boxes into a single vertex buffer. Each vertex
+// carries an alpha pulse (evaluated in the vertex shader from a time uniform)
+// and a group index; groups are small per-draw transforms (offset, scale,
+// yaw) shared by every instance. Per frame the caller only fills the group
+// table and the instance list (position + yaw), so an icon that used to be
+// ~20 BatchCube calls is one instanced draw per prefab. Without shader
+// support the same maths runs on the CPU through rlBegin/rlEnd.
+
+namespace render {
+
+// Must match the uniform array size in the prefab vertex shader.
+constexpr int kPrefabMaxGroups = 16;
+
+// alpha *= base + amp * sin(freq * time + phase)
+struct PrefabPulse {
+  float freq = 0.0f;
+  float phase = 0.0f;
+  float base = 1.0f;
+  float amp = 0.0f;
+};
+
+// Per-frame transform of one vertex group:
+//   local = R(yaw + instanceYaw * inst.yaw) * (v * (scale, scaleY, scale))
+//   world = inst.position + local + offset + (0, instanceY * inst.y, 0)
+struct PrefabGroup {
+  Vector3 offset = {};
+  float scale = 1.0f;
+  float scaleY = 1.0f;
+  float yawRad = 0.0f;
+  float instanceYaw = 0.0f; // Weight of the instance yaw (0 or 1)
+  float instanceY = 0.0f;   // Weight of the instance Y added to offset.y
+};
+
+struct PrefabInstance {
+  Vector3 position = {};
+  float yawRad = 0.0f;
+};
+
+struct PrefabBuilder {
+  MeshBuilder mesh;
+  std::vector<float> pulses; // freq, phase, base, amp per vertex
+  std::vector<float> groups; // group index per vertex
+
+  void Clear();
+  int VertexCount() const { return mesh.VertexCount(); }
+  void AddBox(Vector3 center, Vector3 size, Color color,
+              const PrefabPulse &pulse = {}, int group = 0);
+};
+
+struct Prefab {
+  PrefabBuilder cpu;     // Kept for the immediate-mode fallback
+  unsigned int vao = 0;  // 0 when drawn through the fallback
+  unsigned int vbos[4] = {};
+  int vertexCount = 0;
+};
+
+struct PrefabStats {
+  int prefabs = 0;           // Live prefabs
+  int drawCalls = 0;         // Instanced draws issued
+  int instances = 0;         // Instances drawn
+  int immediateVertices = 0; // Vertices drawn through the fallback path
+};
+
+// Needs a GL context. Safe to call more than once.
+void InitPrefabs();
+void CleanupPrefabs();
+
+// Upload `builder` (moved into the prefab). Without a GL context or shader
+// the prefab still draws through the fallback.
+Prefab LoadPrefab(PrefabBuilder &&builder);
+void UnloadPrefab(Prefab &prefab);
+
+// Draw `count` instances. `groups[g]` transforms vertices of group g; groups
+// past `groupCount` are left at identity.
+void DrawPrefab(const Prefab &prefab, const PrefabGroup *groups,
+                int groupCount, const PrefabInstance *instances, int count,
+                float time);
+
+// CPU evaluation of the vertex shader, used by the fallback.
+Vector3 PrefabVertexPosition(const PrefabGroup &group,
+                             const PrefabInstance &instance, Vector3 vertex);
+float PrefabPulseAlpha(const PrefabPulse &pulse, float time);
+
+// Per-frame counters. Reset at the start of RenderFrame.
+void ResetPrefabStats();
+const PrefabStats &GetPrefabStats();
+
+} // namespace render
@@ -0,0 +1,139 @@
+#include "render/ReadbackQueue.hpp"
+
+#include <cstddef>
+#include <utility>
+
+#include "core/PerfTracker.hpp"
+
+namespace render {
+
+namespace {
+
+void WriterMain(ReadbackQueue &queue) {
+  perf::AllocScope allocScope(perf::AllocTag::Render);
+  std::unique_lock<std::mutex> lock(queue.mutex);
+  for (;;) {
+    queue.wake.wait(lock,
+                    [&] { return queue.stopping || !queue.jobs.empty(); });
+    // Drain everything before honouring a stop.
+    if (queue.jobs.empty())
+      return;
+    const int index = queue.jobs.front();
+    queue.jobs.pop_front();
+    lock.unlock();
+
+    const bool ok = queue.write(index);
+
+    lock.lock();
+    queue.slots[index].busy = false;
+    --queue.stats.pending;
+    if (ok)
+      ++queue.stats.written;
+    else
+      ++queue.stats.failed;
+    queue.slotFree.notify_all();
+  }
+}
+
+int FindFreeSlot(const ReadbackQueue &queue) {
+  for (size_t i = 0; i < queue.slots.size(); ++i) {
+    if (!queue.slots[i].busy)
+      return static_cast<int>(i);
+  }
+  return -1;
+}
+
+} // namespace
+
+void StartReadbackWriter(ReadbackQueue &queue, ReadbackWriteFn write) {
+  if (queue.writer.joinable())
+    return;
+  queue.write = std::move(write);
+  queue.stopping = false;
+  queue.writer = std::thread(WriterMain, std::ref(queue));
+}
+
+bool IsReadbackWriterRunning(const ReadbackQueue &queue) {
+  return queue.writer.joinable();
+}
+
+void ReserveReadbackSlots(ReadbackQueue &queue, int width, int height) {
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  for (ReadbackSlot &slot : queue.slots) {
+    if (!slot.busy)
+      slot.pixels.resize(static_cast<size_t>(width) * height * 4);
+  }
+}
+
+int AcquireReadbackSlot(ReadbackQueue &queue, int width, int height) {
+  int index = -1;
+  {
+    std::unique_lock<std::mutex> lock(queue.mutex);
+    index = FindFreeSlot(queue);
+    if (index < 0) {
+      ++queue.stats.stalls;
+      queue.slotFree.wait(lock,
+                          [&] { return (index = FindFreeSlot(queue)) >= 0; });
+    }
+    queue.slots[index].busy = true;
+    ++queue.stats.pending;
+  }
+  ReadbackSlot &slot = queue.slots[index];
+  slot.width = width;
+  slot.height = height;
+  slot.pixels.resize(static_cast<size_t>(width) * height * 4);
+  return index;
+}
+
+void SubmitReadbackSlot(ReadbackQueue &queue, int slot) {
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.jobs.push_back(slot);
+  }
+  queue.wake.notify_one();
+}
+
+void ReleaseReadbackSlot(ReadbackQueue &queue, int slot) {
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.slots[slot].busy = false;
+    --queue.stats.pending;
+    ++queue.stats.failed;
+  }
+  queue.slotFree.notify_all();
+}
+
+void FlushReadbacks(ReadbackQueue &queue) {
+  std::unique_lock<std::mutex> lock(queue.mutex);
+  queue.slotFree.wait(lock, [&] { return queue.stats.pending == 0; });
+}
+
+void StopReadbackWriter(ReadbackQueue &queue) {
+  if (queue.writer.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.stopping = true;
+    }
+    queue.wake.notify_one();
+    queue.writer.join();
+  }
+  for (ReadbackSlot &slot : queue.slots)
+    slot.pixels = {};
+}
+
+ReadbackStats GetReadbackStats(ReadbackQueue &queue) {
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  return queue.stats;
+}
+
+// In place works because each destination pixel ends before its source
+// begins.
+void PackRgb(unsigned char *pixels, int count) {
+  for (int i = 0; i < count; ++i) {
+    pixels[i * 3 + 0] = pixels[i * 4 + 0];
+    pixels[i * 3 + 1] = pixels[i * 4 + 1];
+    pixels[i * 3 + 2] = pixels[i * 4 + 2];
+  }
+}
+
+} // namespace render
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pooled frame readback buffers drained in order by one writer thread.
+//
+// The main thread acquires a free slot, reads a frame into it and submits
+// it; the writer thread hands submitted slots to a ReadbackWriteFn one at a
+// time, in submission order, and frees them again. When every slot is in
+// flight, acquiring blocks until the writer frees one, so a burst of
+// captures runs at the writer's pace instead of growing memory. Shared by
+// render/ScreenshotQueue and render/FrameRecorder, which keep their
+// per-slot metadata in arrays indexed like `slots`.
+//
+// Slots are acquired and submitted from the main thread only.
+
+namespace render {
+
+// Called on the writer thread with a submitted slot's index. True if the
+// slot was written out.
+using ReadbackWriteFn = std::function<bool(int slot)>;
+
+struct ReadbackSlot {
+  std::vector<unsigned char> pixels; // RGBA8 top-down; grows, never shrinks
+  int width = 0;
+  int height = 0;
+  bool busy = false; // Being filled or waiting on the writer
+};
+
+struct ReadbackStats {
+  int pending = 0; // Acquired, not written or released yet
+  int written = 0;
+  int failed = 0; // Released unwritten, or the write function failed
+  int stalls = 0; // Acquires that waited for a free slot
+};
+
+struct ReadbackQueue {
+  explicit ReadbackQueue(int slotCount) : slots(slotCount) {}
+
+  // Shared with the writer, guarded by `mutex`. A busy slot's contents
+  // belong to the main thread until it is submitted, then to the writer
+  // until it clears `busy`.
+  std::mutex mutex;
+  std::condition_variable wake;     // A slot was submitted or we are stopping
+  std::condition_variable slotFree; // A slot was written or released
+  std::vector<ReadbackSlot> slots;
+  std::deque<int> jobs;
+  ReadbackStats stats;
+  bool stopping = false;
+
+  // Main thread only.
+  std::thread writer;
+  ReadbackWriteFn write;
+};
+
+// Start the writer thread; no-op if it is already running.
+void StartReadbackWriter(ReadbackQueue &queue, ReadbackWriteFn write);
+
+bool IsReadbackWriterRunning(const ReadbackQueue &queue);
+
+// Size every slot for `width` x `height` up front.
+void ReserveReadbackSlots(ReadbackQueue &queue, int width, int height);
+
+// Take a free slot sized for `width` x `height`, blocking while every slot
+// is in flight.
+int AcquireReadbackSlot(ReadbackQueue &queue, int width, int height);
+
+// Queue an acquired slot for the writer.
+void SubmitReadbackSlot(ReadbackQueue &queue, int slot);
+
+// Give back an acquired slot that won't be submitted; counted as failed.
+void ReleaseReadbackSlot(ReadbackQueue &queue, int slot);
+
+// Block until every acquired slot is written or released.
+void FlushReadbacks(ReadbackQueue &queue);
+
+// Write out everything submitted, join the writer and free the slot
+// buffers. Safe to call when the writer isn't running.
+void StopReadbackWriter(ReadbackQueue &queue);
+
+ReadbackStats GetReadbackStats(ReadbackQueue &queue);
+
+// Drop alpha from `count` RGBA8 pixels, leaving packed RGB8 at the start of
+// the same buffer.
+void PackRgb(unsigned char *pixels, int count);
+
+} // namespace render
@@ -6,12 +6,25 @@
 #include "core/Assets.hpp"
 #include "core/Config.hpp"
 #include "core/Log.hpp"
+#include "core/ParticleSystem.hpp"
 #include "game/Game.hpp"
+#include "render/CubeBatch.hpp"
+#include "render/DrawStats.hpp"
+#include "render/EndlessMesh.hpp"
+#include "render/FrameRecorder.hpp"
+#include "render/FrameTarget.hpp"
+#include "render/Frustum.hpp"
 #include "render/GateRenderer.hpp"
 #include "render/HudWidgets.hpp"
+#include "render/LevelMesh.hpp"
+#include "render/LevelPreload.hpp"
+#include "render/Lod.hpp"
 #include "render/Palette.hpp"
+#include "render/PowerUpRenderer.hpp"
+#include "render/Prefab.hpp"
 #include "render/RenderUtils.hpp"
 #include "render/SceneDressing.hpp"
+#include "render/ScreenshotQueue.hpp"
 #include "render/SpaceObjects.hpp"
 #include "rlgl.h"
 #include "sim/Level.hpp"
@@ -38,52 +51,29 @@ Model g_shipModel = {};
 Texture2D g_inputTilemap = {};
 Texture2D g_hudReferenceImage = {};
 
-// ─── Engine exhaust (render-side preallocated pool) ──────────────────────────
-
-struct ExhaustParticle {
-  bool active = false;
-  Vector3 pos = {};
-  Vector3 vel = {};
-  float life = 0.0f;
-  float maxLife = 0.0f;
-};
-
-ExhaustParticle g_exhaust[cfg::kExhaustParticleCount] = {};
-int g_exhaustNextIdx = 0;
-
-void SpawnExhaustParticle(const Vector3 &origin, float speedBoost,
-                          uint32_t &rng) {
-  auto &p = g_exhaust[g_exhaustNextIdx];
-  g_exhaustNextIdx = (g_exhaustNextIdx + 1) % cfg::kExhaustParticleCount;
-  p.active = true;
-  p.pos = origin;
+// ─── Engine exhaust (render-side particle pool) ──────────────────────────────
+
+// Exhaust spreads out behind the ship and settles; no gravity. Puffs move
+// before their drag is applied.
+constexpr core::ParticleMotion kExhaustMotion = {
+    {3.0f, 3.0f, 0.0f}, 0.0f, true};
+
+core::ParticleSystem<cfg::kExhaustParticleCount> g_exhaust;
+
+// A full pool recycles the puff closest to dying, so the trail stays on the
+// ship at any frame rate.
+void EmitExhaust(const Vector3 &origin, float speedBoost, uint32_t &rng) {
   const float sx =
       (render::HashFloat01(rng) - 0.5f) * 2.0f * cfg::kExhaustSpreadX;
   rng = render::Hash(rng + 1);
   const float sy =
       (render::HashFloat01(rng) - 0.5f) * 2.0f * cfg::kExhaustSpreadY;
   rng = render::Hash(rng + 1);
-  p.vel = {sx, sy, -(cfg::kExhaustBaseSpeed + speedBoost * 0.4f)};
-  p.life = cfg::kExhaustParticleLife * (0.6f + 0.8f * render::HashFloat01(rng));
+  const float life =
+      cfg::kExhaustParticleLife * (0.6f + 0.8f * render::HashFloat01(rng));
   rng = render::Hash(rng + 1);
-  p.maxLife = p.life;
-}
-
-void UpdateExhaustParticles(float dt) {
-  for (auto &p : g_exhaust) {
-    if (!p.active)
-      continue;
-    p.life -= dt;
-    if (p.life <= 0.0f) {
-      p.active = false;
-      continue;
-    }
-    p.pos.x += p.vel.x * dt;
-    p.pos.y += p.vel.y * dt;
-    p.pos.z += p.vel.z * dt;
-    p.vel.x *= (1.0f - 3.0f * dt);
-    p.vel.y *= (1.0f - 3.0f * dt);
-  }
+  const float vz = -(cfg::kExhaustBaseSpeed + speedBoost * 0.4f);
+  g_exhaust.SpawnOrRecycle(origin, {sx, sy, vz}, life);
 }
 
 // ─── Camera
@@ -129,6 +119,117 @@ Color GetDecoCubeColor(const LevelPalette &p, int idx) {
   return p.decoCube3;
 }
 
+// ─── Obstacles
+// ────────────────────────────────────────────────────────────────
+
+render::LodState<kMaxObstacles> g_obstacleLod;
+
+// Full detail adds each shape's caps, tips and halos plus the deco base;
+// Reduced keeps the body and its wireframe; Minimal draws the body alone.
+void BatchObstacle(const LevelObstacle &ob, const LevelPalette &pal,
+                   render::LodTier lod) {
+  // Safety checks: clamp colorIndex to valid range (0-2), rotation to valid range
+  const int safeColorIndex = (ob.colorIndex < 0) ? 0 : (ob.colorIndex > 2 ? 2 : ob.colorIndex);
+  const float safeRotation = (ob.rotation < -360.0f) ? 0.0f : ob.rotation;
+  // Safety check: default to Cube if shape is Unset
+  const ObstacleShape safeShape = (ob.shape == ObstacleShape::Unset) ? ObstacleShape::Cube : ob.shape;
+  const Color obCol = GetDecoCubeColor(pal, safeColorIndex);
+  const bool full = lod == render::LodTier::Full;
+
+  const render::CubeFrame frame = render::MakeCubeFrame(
+      {ob.x, ob.y + ob.sizeY * 0.5f, ob.z}, safeRotation);
+
+  // Main body, which every tier draws.
+  Vector3 bodyPos = {0.0f, 0.0f, 0.0f};
+  Vector3 bodySize = {ob.sizeX, ob.sizeY, ob.sizeZ};
+  switch (safeShape) {
+  case ObstacleShape::Pyramid: {
+    const float bH = ob.sizeY * 0.7f;
+    bodyPos = {0.0f, -ob.sizeY * 0.5f + bH * 0.5f, 0.0f};
+    bodySize = {ob.sizeX, bH, ob.sizeZ};
+    break;
+  }
+  case ObstacleShape::Spike:
+    bodySize = {ob.sizeX * 0.6f, ob.sizeY, ob.sizeZ * 0.6f};
+    break;
+  case ObstacleShape::Wall:
+    bodyPos = {0.0f, -ob.sizeY * 0.2f, 0.0f};
+    bodySize = {ob.sizeX, ob.sizeY * 0.6f, ob.sizeZ};
+    break;
+  case ObstacleShape::Sphere: {
+    const float avg = (ob.sizeX + ob.sizeY + ob.sizeZ) / 3.0f;
+    bodySize = {avg, avg, avg};
+    break;
+  }
+  default:
+    break;
+  }
+  render::BatchCube(frame, bodyPos, bodySize, Fade(obCol, 0.4f));
+
+  if (full) {
+    switch (safeShape) {
+    case ObstacleShape::Cylinder:
+      render::BatchCube(frame,
+                        {0.0f, ob.sizeY * 0.5f - ob.sizeX * 0.3f, 0.0f},
+                        {ob.sizeX * 0.9f, ob.sizeX * 0.3f, ob.sizeZ * 0.9f},
+                        Fade(obCol, 0.5f));
+      render::BatchCube(frame,
+                        {0.0f, -ob.sizeY * 0.5f + ob.sizeX * 0.3f, 0.0f},
+                        {ob.sizeX * 0.9f, ob.sizeX * 0.3f, ob.sizeZ * 0.9f},
+                        Fade(obCol, 0.5f));
+      break;
+    case ObstacleShape::Pyramid: {
+      const float tipY = -ob.sizeY * 0.5f + bodySize.y + ob.sizeY * 0.15f;
+      render::BatchCube(frame, {0.0f, tipY, 0.0f},
+                        {ob.sizeX * 0.5f, ob.sizeY * 0.3f, ob.sizeX * 0.5f},
+                        Fade(obCol, 0.5f));
+      break;
+    }
+    case ObstacleShape::Spike:
+      render::BatchCube(frame,
+                        {0.0f, ob.sizeY * 0.5f - ob.sizeX * 0.15f, 0.0f},
+                        {ob.sizeX * 0.3f, ob.sizeX * 0.3f, ob.sizeX * 0.3f},
+                        Fade(obCol, 0.6f));
+      break;
+    case ObstacleShape::Sphere:
+      render::BatchCube(frame, bodyPos,
+                        {bodySize.x * 1.1f, bodySize.y * 1.1f,
+                         bodySize.z * 1.1f},
+                        Fade(obCol, 0.15f));
+      break;
+    default:
+      break;
+    }
+  }
+
+  if (lod != render::LodTier::Minimal)
+    render::BatchCubeWires(frame, bodyPos, bodySize, obCol);
+
+  if (full) {
+    // Deco base
+    render::BatchCube(frame, {0.0f, -ob.sizeY * 0.5f + 0.02f, 0.0f},
+                      {ob.sizeX * 1.5f, 0.01f, ob.sizeZ * 1.5f},
+                      Fade(obCol, 0.15f));
+  }
+}
+
+// ─── Level preloading
+// ─────────────────────────────────────────────────────────
+
+// Queue the levels the player is most likely to start next, so their meshes
+// are built before the run begins: the hovered level select entry, or the
+// next level of the stage during a run.
+void PreloadLikelyLevels(const Game &game) {
+  if (game.screen == GameScreen::LevelSelect) {
+    render::PreloadLevel(GetLevelIndexFromStageAndLevel(game.levelSelectStage,
+                                                        game.levelSelectLevel),
+                         game.paletteIndex);
+  } else if (game.screen == GameScreen::Playing && !game.isEndlessMode &&
+             GetLevelInStageFromLevelIndex(game.currentLevelIndex) < 3) {
+    render::PreloadLevel(game.currentLevelIndex + 1, game.paletteIndex);
+  }
+}
+
 } // anonymous namespace
 
 // ─── Public API
@@ -139,7 +240,13 @@ void RegenerateSpaceObjects(uint32_t seed) {
   render::RegenerateSpaceObjects(seed);
 }
 
+core::ParticleStats GetExhaustParticleStats() { return g_exhaust.Stats(); }
+
 void InitRenderer() {
+  render::InitDrawStats();
+  render::InitCubeBatch();
+  render::InitPrefabs();
+  render::InitPowerUpLabels();
   if (!g_shipLoaded) {
     g_shipModel = LoadModel(assets::Path("models/craft_speederA.obj"));
     g_shipLoaded = true;
@@ -181,6 +288,7 @@ void InitRenderer() {
         render::g_backgroundTextures[i] = LoadTexture(assets::Path(bgPaths[i]));
         SetTextureFilter(render::g_backgroundTextures[i],
                          TEXTURE_FILTER_BILINEAR);
+        SetTextureWrap(render::g_backgroundTextures[i], TEXTURE_WRAP_REPEAT);
         render::g_backgroundTexturesLoaded = true;
       }
     }
@@ -190,6 +298,19 @@ void InitRenderer() {
 }
 
 void CleanupRenderer() {
+  render::StopRecording();
+  render::ShutdownScreenshotQueue();
+  render::ShutdownEndlessMesh();
+  render::ShutdownLevelPreloader();
+  render::UnloadLevelMesh();
+  render::UnloadGatePrefabs();
+  render::UnloadPowerUpPrefabs();
+  render::UnloadPowerUpLabels();
+  render::UnloadSpaceObjectPrefabs();
+  render::UnloadCockpitHUD();
+  render::UnloadBackdrop();
+  render::CleanupPrefabs();
+  render::CleanupCubeBatch();
   if (g_shipLoaded) {
     UnloadModel(g_shipModel);
     g_shipLoaded = false;
@@ -209,6 +330,7 @@ void CleanupRenderer() {
     }
     render::g_texturesLoaded = false;
   }
+  render::ShutdownDrawStats();
 }
 
 // ─── Main render frame
@@ -217,6 +339,9 @@ void CleanupRenderer() {
 void RenderFrame(Game &game, float alpha, float renderDt) {
   // One-time init of static scene dressing
   render::InitSceneDressing();
+  render::ResetCubeBatchStats();
+  render::ResetPrefabStats();
+  PreloadLikelyLevels(game);
 
   const LevelPalette &pal = GetPalette(game.paletteIndex);
   const Vector3 playerRenderPos = render::InterpolatePosition(game, alpha);
@@ -229,6 +354,11 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
                                        cfg::kDashSpeedBoost);
   game.camera.fovy =
       cfg::kCameraBaseFov + (cfg::kCameraMaxFov - cfg::kCameraBaseFov) * speedT;
+  // BeginMode3D projects with the full framebuffer aspect even when the 3D
+  // viewport is shortened for the HUD.
+  const float aspect = static_cast<float>(cfg::kScreenWidth) /
+                       static_cast<float>(cfg::kScreenHeight);
+  render::BeginCullFrame(game.camera, aspect);
 
   const float simTime = static_cast<float>(game.simTicks) * cfg::kFixedDt;
 
@@ -240,7 +370,9 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
   }
   render::UpdateSpaceObjects(renderDt, playerRenderPos);
 
-  BeginDrawing();
+  render::BeginDrawStatsFrame();
+  render::SetDrawPass(render::DrawPass::Space);
+  render::BeginFrame();
   ClearBackground(BLACK);
 
   // Scrolling background
@@ -256,29 +388,27 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
                             ? (cfg::kScreenHeight * 2 / 3)
                             : cfg::kScreenHeight;
   const int viewportHeight = hudStartY;
+  // The 3D projection spans the viewport, not the whole screen, in play.
+  render::BeginLodFrame(game.camera, static_cast<float>(viewportHeight));
   const int bgHeight = (game.screen == GameScreen::Playing)
                            ? viewportHeight
                            : cfg::kScreenHeight;
 
-  render::DrawBackgroundWithGrid(bgTextureIndex, backgroundScroll, pal,
-                                 cfg::kScreenWidth, bgHeight, 0.85f);
-  DrawRectangleGradientV(0, 0, cfg::kScreenWidth, bgHeight, Fade(BLACK, 0.0f),
-                         Fade(BLACK, 0.3f));
-
-  // Sky gradient
+  // Grid, darkening and sky gradients over the background texture
   const bool isPlaying = (game.screen == GameScreen::Playing);
-  const Color skyTop = (isPlaying && game.currentStage >= 1)
-                           ? render::GetStageBackgroundTop(game.currentStage)
-                           : pal.skyTop;
-  const Color skyBottom =
-      (isPlaying && game.currentStage >= 1)
-          ? render::GetStageBackgroundBottom(game.currentStage)
-          : pal.skyBottom;
-  DrawRectangleGradientV(0, 0, cfg::kScreenWidth, viewportHeight,
-                         Fade(skyTop, 0.4f), Fade(skyBottom, 0.5f));
-  DrawRectangleGradientV(0, viewportHeight / 2, cfg::kScreenWidth,
-                         viewportHeight / 2, Fade(BLACK, 0.0f),
-                         Fade(pal.voidTint, 0.3f));
+  render::BackdropStyle backdrop;
+  backdrop.gridLine = pal.gridLine;
+  backdrop.skyTop = (isPlaying && game.currentStage >= 1)
+                        ? render::GetStageBackgroundTop(game.currentStage)
+                        : pal.skyTop;
+  backdrop.skyBottom = (isPlaying && game.currentStage >= 1)
+                           ? render::GetStageBackgroundBottom(game.currentStage)
+                           : pal.skyBottom;
+  backdrop.voidTint = pal.voidTint;
+  backdrop.bgHeight = bgHeight;
+  backdrop.skyHeight = viewportHeight;
+  backdrop.alpha = 0.85f;
+  render::DrawBackdrop(bgTextureIndex, backgroundScroll, backdrop);
 
   // Scissor 3D to viewport (exclude cockpit HUD)
   // Both rlViewport and rlScissor use OpenGL coordinates (bottom-left origin)
@@ -305,132 +435,122 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
   render::RenderSpaceObjects(game.camera, pal, simTime);
 
   // Mountains
+  render::SetDrawPass(render::DrawPass::Mountains);
   render::RenderMountains(pal, playerRenderPos);
+  render::FlushCubeBatch();
 
   // ── Level geometry ────────────────────────────────────────────────────────
+  render::SetDrawPass(render::DrawPass::Level);
   const Level *lv = game.level;
   const float guideY =
       cfg::kPlatformTopY + 0.02f; // fallback Y for speed streaks
 
   if (lv) {
+    // Built-in levels are static: draw their baked chunks and only keep the
+    // wireframes and scrolling lateral grid per segment. Endless levels are
+    // meshed incrementally; segments still in flight use the cube batch.
+    const bool baked = !game.isEndlessMode &&
+                       render::EnsureLevelMesh(*lv, pal, game.paletteIndex);
+    int meshedSegments = 0; // Endless: leading segments with uploaded meshes
+    if (baked) {
+      render::ResetEndlessMesh();
+      render::DrawLevelMesh(playerRenderPos.z, cfg::kLevelDrawDistance);
+    } else if (game.isEndlessMode) {
+      meshedSegments = render::UpdateEndlessMesh(
+          *lv, pal, game.paletteIndex, playerRenderPos.z);
+      render::DrawEndlessMesh(playerRenderPos.z, cfg::kLevelDrawDistance);
+    }
+
+    // Frustum-cull the segments within draw distance in one pass. The box
+    // covers the body (height as in GetSegmentStyle) plus the neon edges.
+    render::BoxBatch<kMaxSegments> segBounds;
     for (int si = 0; si < lv->segmentCount; ++si) {
       const auto &seg = lv->segments[si];
       const float segMidZ = seg.startZ + seg.length * 0.5f;
-      if (std::fabs(segMidZ - playerRenderPos.z) > 80.0f)
+      if (std::fabs(segMidZ - playerRenderPos.z) > cfg::kLevelDrawDistance)
         continue;
+      const float bodyH = cfg::kPlatformHeight *
+                          (seg.heightScale < 0.0f ? 1.0f : seg.heightScale);
+      const float topH = cfg::kNeonEdgeHeight * 2.5f;
+      segBounds.Add(si,
+                    {seg.xOffset, seg.topY + (topH - bodyH) * 0.5f, segMidZ},
+                    {seg.width * 0.5f + cfg::kNeonEdgeWidth * 1.5f,
+                     (topH + bodyH) * 0.5f, seg.length * 0.5f});
+    }
+    segBounds.Cull();
 
+    for (int k = 0; k < segBounds.count; ++k) {
+      if (!segBounds.visible[k])
+        continue;
+      const int si = segBounds.id[k];
+      const auto &seg = lv->segments[si];
+      const float segMidZ = seg.startZ + seg.length * 0.5f;
       const float segEndZ = seg.startZ + seg.length;
       const float halfW = seg.width * 0.5f;
-      // Safety check: if heightScale is negative (unassigned), use default value
-      const float effectiveHeightScale = (seg.heightScale < 0.0f) ? 1.0f : seg.heightScale;
-      const float visualH = cfg::kPlatformHeight * effectiveHeightScale;
-
-      // Safety check: clamp colorTint to valid range (0-2)
-      const int safeColorTint = (seg.colorTint < 0) ? 0 : (seg.colorTint > 2 ? 2 : seg.colorTint);
-      Color platformSideCol =
-          render::ApplyColorTint(pal.platformSide, safeColorTint);
-      Color platformTopCol =
-          render::ApplyColorTint(pal.platformTop, safeColorTint);
-      Color platformWireCol =
-          render::ApplyColorTint(pal.platformWire, safeColorTint);
-      Color neonEdgeCol = pal.neonEdge;
-      Color neonGlowCol = pal.neonEdgeGlow;
-      float wireAlpha = 0.5f;
-      float glowIntensity = 0.15f;
-      bool drawGrid = true;
-
-      // Safety check: clamp variantIndex to valid range (0-7)
-      const int safeVariantIndex = (seg.variantIndex < 0) ? 0 : (seg.variantIndex > 7 ? 7 : seg.variantIndex);
-      switch (safeVariantIndex) {
-      case 1:
-        wireAlpha = 0.3f;
-        break;
-      case 2:
-        wireAlpha = 0.7f;
-        break;
-      case 3:
-        platformSideCol = render::ApplyColorTint(pal.platformSide, 1);
-        break;
-      case 4:
-        platformSideCol =
-            Color{static_cast<unsigned char>(platformSideCol.r * 0.8f),
-                  static_cast<unsigned char>(platformSideCol.g * 0.8f),
-                  static_cast<unsigned char>(platformSideCol.b * 0.8f), 255};
-        break;
-      case 5:
-        glowIntensity = 0.3f;
-        neonEdgeCol = Color{
-            static_cast<unsigned char>(std::min(255, pal.neonEdge.r + 40)),
-            static_cast<unsigned char>(std::min(255, pal.neonEdge.g + 40)),
-            static_cast<unsigned char>(std::min(255, pal.neonEdge.b + 40)),
-            255};
-        break;
-      case 6:
-        wireAlpha = 0.0f;
-        drawGrid = false;
-        platformSideCol =
-            Color{static_cast<unsigned char>(platformSideCol.r * 0.7f),
-                  static_cast<unsigned char>(platformSideCol.g * 0.7f),
-                  static_cast<unsigned char>(platformSideCol.b * 0.7f), 255};
-        break;
-      default:
-        break;
-      }
-
-      DrawCubeV(Vector3{seg.xOffset, seg.topY - visualH * 0.5f, segMidZ},
-                Vector3{seg.width, visualH, seg.length}, platformSideCol);
-      DrawCubeV(Vector3{seg.xOffset, seg.topY - 0.01f, segMidZ},
-                Vector3{seg.width, 0.02f, seg.length}, platformTopCol);
-
-      if (wireAlpha > 0.0f) {
-        DrawCubeWiresV(Vector3{seg.xOffset, seg.topY - visualH * 0.5f, segMidZ},
-                       Vector3{seg.width, visualH, seg.length},
-                       Fade(platformWireCol, wireAlpha));
+      const render::SegmentStyle style = render::GetSegmentStyle(seg, pal);
+      const float visualH = style.visualHeight;
+      const bool segMeshed = baked || si < meshedSegments;
+
+      if (!segMeshed) {
+        const Vector3 bodyPos = {seg.xOffset, seg.topY - visualH * 0.5f,
+                                 segMidZ};
+        const Vector3 bodySize = {seg.width, visualH, seg.length};
+        render::BatchCube(bodyPos, bodySize, style.side);
+        render::BatchCube(Vector3{seg.xOffset, seg.topY - 0.01f, segMidZ},
+                          Vector3{seg.width, 0.02f, seg.length}, style.top);
+
+        const float leftEdge = seg.xOffset - halfW;
+        const float rightEdge = seg.xOffset + halfW;
+        const float edgeY = seg.topY + cfg::kNeonEdgeHeight * 0.5f;
+        const Vector3 edgeSize = {cfg::kNeonEdgeWidth, cfg::kNeonEdgeHeight,
+                                  seg.length};
+        const Vector3 edgeGlowSize = {cfg::kNeonEdgeWidth * 3.0f,
+                                      cfg::kNeonEdgeHeight * 2.5f, seg.length};
+        render::BatchCube(Vector3{leftEdge, edgeY, segMidZ}, edgeSize,
+                          style.neonEdge);
+        render::BatchCube(Vector3{rightEdge, edgeY, segMidZ}, edgeSize,
+                          style.neonEdge);
+        render::BatchCube(Vector3{leftEdge, edgeY, segMidZ}, edgeGlowSize,
+                          Fade(style.neonGlow, style.glowIntensity));
+        render::BatchCube(Vector3{rightEdge, edgeY, segMidZ}, edgeGlowSize,
+                          Fade(style.neonGlow, style.glowIntensity));
+
+        // Striped variant
+        if (style.striped) {
+          constexpr int stripeCount = 8;
+          for (int st = 0; st < stripeCount; ++st) {
+            const float t =
+                static_cast<float>(st) / static_cast<float>(stripeCount);
+            const Color sc = (st % 2 == 0)
+                                 ? style.top
+                                 : render::ApplyColorTint(style.top, 1);
+            render::BatchCube(
+                Vector3{seg.xOffset, seg.topY + 0.01f,
+                        seg.startZ + t * seg.length},
+                Vector3{seg.width, 0.015f, seg.length / stripeCount},
+                Fade(sc, 0.6f));
+          }
+        }
       }
 
-      const float leftEdge = seg.xOffset - halfW;
-      const float rightEdge = seg.xOffset + halfW;
-      const float edgeY = seg.topY + cfg::kNeonEdgeHeight * 0.5f;
-      DrawCubeV(Vector3{leftEdge, edgeY, segMidZ},
-                Vector3{cfg::kNeonEdgeWidth, cfg::kNeonEdgeHeight, seg.length},
-                neonEdgeCol);
-      DrawCubeV(Vector3{rightEdge, edgeY, segMidZ},
-                Vector3{cfg::kNeonEdgeWidth, cfg::kNeonEdgeHeight, seg.length},
-                neonEdgeCol);
-      DrawCubeV(Vector3{leftEdge, edgeY, segMidZ},
-                Vector3{cfg::kNeonEdgeWidth * 3.0f, cfg::kNeonEdgeHeight * 2.5f,
-                        seg.length},
-                Fade(neonGlowCol, glowIntensity));
-      DrawCubeV(Vector3{rightEdge, edgeY, segMidZ},
-                Vector3{cfg::kNeonEdgeWidth * 3.0f, cfg::kNeonEdgeHeight * 2.5f,
-                        seg.length},
-                Fade(neonGlowCol, glowIntensity));
-
-      // Striped variant
-      if (safeVariantIndex == 7) {
-        constexpr int stripeCount = 8;
-        for (int st = 0; st < stripeCount; ++st) {
-          const float t =
-              static_cast<float>(st) / static_cast<float>(stripeCount);
-          const Color sc = (st % 2 == 0)
-                               ? platformTopCol
-                               : render::ApplyColorTint(platformTopCol, 1);
-          DrawCubeV(Vector3{seg.xOffset, seg.topY + 0.01f,
-                            seg.startZ + t * seg.length},
-                    Vector3{seg.width, 0.015f, seg.length / stripeCount},
-                    Fade(sc, 0.6f));
-        }
+      if (style.wireAlpha > 0.0f) {
+        render::BatchCubeWires(
+            Vector3{seg.xOffset, seg.topY - visualH * 0.5f, segMidZ},
+            Vector3{seg.width, visualH, seg.length},
+            Fade(style.wire, style.wireAlpha));
       }
 
       // Grid lines
-      if (drawGrid) {
+      if (style.drawGrid) {
         const float sGuideY = seg.topY + 0.02f;
-        for (int gi = 0; gi < cfg::kGridLongitudinalCount; ++gi) {
-          const float t = static_cast<float>(gi) /
-                          static_cast<float>(cfg::kGridLongitudinalCount - 1);
-          const float gx = seg.xOffset - halfW + t * seg.width;
-          DrawLine3D(Vector3{gx, sGuideY, seg.startZ},
-                     Vector3{gx, sGuideY, segEndZ}, Fade(pal.gridLine, 0.3f));
+        if (!segMeshed) {
+          for (int gi = 0; gi < cfg::kGridLongitudinalCount; ++gi) {
+            const float t = static_cast<float>(gi) /
+                            static_cast<float>(cfg::kGridLongitudinalCount - 1);
+            const float gx = seg.xOffset - halfW + t * seg.width;
+            DrawLine3D(Vector3{gx, sGuideY, seg.startZ},
+                       Vector3{gx, sGuideY, segEndZ}, Fade(pal.gridLine, 0.3f));
+          }
         }
         if (std::fabs(segMidZ - playerRenderPos.z) < 30.0f) {
           const float latPhase =
@@ -449,303 +569,37 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
       }
     }
 
-    // Obstacles
+    // Obstacles. The sphere covers the rotated body and the wider deco base.
+    render::SetDrawPass(render::DrawPass::Obstacles);
+    render::SphereBatch<kMaxObstacles> obBounds;
     for (int oi = 0; oi < lv->obstacleCount; ++oi) {
       const auto &ob = lv->obstacles[oi];
       if (std::fabs(ob.z - playerRenderPos.z) > 60.0f)
         continue;
+      const float radius =
+          0.75f * std::sqrt(ob.sizeX * ob.sizeX + ob.sizeY * ob.sizeY +
+                            ob.sizeZ * ob.sizeZ);
+      obBounds.Add(oi, {ob.x, ob.y + ob.sizeY * 0.5f, ob.z}, radius);
+    }
+    obBounds.Cull();
 
-      // Safety checks: clamp colorIndex to valid range (0-2), rotation to valid range
-      const int safeColorIndex = (ob.colorIndex < 0) ? 0 : (ob.colorIndex > 2 ? 2 : ob.colorIndex);
-      const float safeRotation = (ob.rotation < -360.0f) ? 0.0f : ob.rotation;
-      // Safety check: default to Cube if shape is Unset
-      const ObstacleShape safeShape = (ob.shape == ObstacleShape::Unset) ? ObstacleShape::Cube : ob.shape;
-      const Color obCol = GetDecoCubeColor(pal, safeColorIndex);
-      const Vector3 obSize = {ob.sizeX, ob.sizeY, ob.sizeZ};
-
-      rlPushMatrix();
-      rlTranslatef(ob.x, ob.y + ob.sizeY * 0.5f, ob.z);
-      rlRotatef(safeRotation, 0.0f, 1.0f, 0.0f);
-
-      const Vector3 localCenter = {0.0f, 0.0f, 0.0f};
-
-      switch (safeShape) {
-      case ObstacleShape::Cube:
-        DrawCubeV(localCenter, obSize, Fade(obCol, 0.4f));
-        DrawCubeWiresV(localCenter, obSize, obCol);
-        break;
-      case ObstacleShape::Cylinder:
-        DrawCubeV(localCenter, obSize, Fade(obCol, 0.4f));
-        DrawCubeV({0.0f, ob.sizeY * 0.5f - ob.sizeX * 0.3f, 0.0f},
-                  {ob.sizeX * 0.9f, ob.sizeX * 0.3f, ob.sizeZ * 0.9f},
-                  Fade(obCol, 0.5f));
-        DrawCubeV({0.0f, -ob.sizeY * 0.5f + ob.sizeX * 0.3f, 0.0f},
-                  {ob.sizeX * 0.9f, ob.sizeX * 0.3f, ob.sizeZ * 0.9f},
-                  Fade(obCol, 0.5f));
-        DrawCubeWiresV(localCenter, obSize, obCol);
-        break;
-      case ObstacleShape::Pyramid: {
-        const float bH = ob.sizeY * 0.7f;
-        DrawCubeV({0.0f, -ob.sizeY * 0.5f + bH * 0.5f, 0.0f},
-                  {ob.sizeX, bH, ob.sizeZ}, Fade(obCol, 0.4f));
-        DrawCubeV({0.0f, -ob.sizeY * 0.5f + bH + ob.sizeY * 0.15f, 0.0f},
-                  {ob.sizeX * 0.5f, ob.sizeY * 0.3f, ob.sizeX * 0.5f},
-                  Fade(obCol, 0.5f));
-        DrawCubeWiresV({0.0f, -ob.sizeY * 0.5f + bH * 0.5f, 0.0f},
-                       {ob.sizeX, bH, ob.sizeZ}, obCol);
-        break;
-      }
-      case ObstacleShape::Spike: {
-        const Vector3 spikeSize = {ob.sizeX * 0.6f, ob.sizeY, ob.sizeZ * 0.6f};
-        DrawCubeV(localCenter, spikeSize, Fade(obCol, 0.4f));
-        DrawCubeV({0.0f, ob.sizeY * 0.5f - ob.sizeX * 0.15f, 0.0f},
-                  {ob.sizeX * 0.3f, ob.sizeX * 0.3f, ob.sizeX * 0.3f},
-                  Fade(obCol, 0.6f));
-        DrawCubeWiresV(localCenter, spikeSize, obCol);
-        break;
-      }
-      case ObstacleShape::Wall: {
-        const Vector3 wallSize = {ob.sizeX, ob.sizeY * 0.6f, ob.sizeZ};
-        DrawCubeV({0.0f, -ob.sizeY * 0.2f, 0.0f}, wallSize, Fade(obCol, 0.4f));
-        DrawCubeWiresV({0.0f, -ob.sizeY * 0.2f, 0.0f}, wallSize, obCol);
-        break;
-      }
-      case ObstacleShape::Sphere: {
-        const float avg = (ob.sizeX + ob.sizeY + ob.sizeZ) / 3.0f;
-        const Vector3 s = {avg, avg, avg};
-        DrawCubeV(localCenter, s, Fade(obCol, 0.4f));
-        DrawCubeV(localCenter, {avg * 1.1f, avg * 1.1f, avg * 1.1f},
-                  Fade(obCol, 0.15f));
-        DrawCubeWiresV(localCenter, s, obCol);
-        break;
-      }
-      default:
-        break;
-      }
-      // Deco base
-      DrawCubeV({0.0f, -ob.sizeY * 0.5f + 0.02f, 0.0f},
-                {ob.sizeX * 1.5f, 0.01f, ob.sizeZ * 1.5f}, Fade(obCol, 0.15f));
-
-      rlPopMatrix();
+    for (int k = 0; k < obBounds.count; ++k) {
+      if (!obBounds.visible[k])
+        continue;
+      const int oi = obBounds.id[k];
+      const render::LodTier lod =
+          g_obstacleLod.Select(oi, lv->obstacles[oi].z,
+                               {obBounds.x[k], obBounds.y[k], obBounds.z[k]},
+                               obBounds.r[k]);
+      BatchObstacle(lv->obstacles[oi], pal, lod);
     }
 
     // Power-ups
-    for (int pi = 0; pi < lv->powerUpCount; ++pi) {
-      const auto &pu = lv->powerUps[pi];
-      if (!pu.active) continue;
-      if (std::fabs(pu.z - playerRenderPos.z) > 60.0f) continue;
-      
-      // Find which segment this power-up is on to get ground level
-      float groundY = pu.y;
-      for (int si = 0; si < lv->segmentCount; ++si) {
-        const auto &seg = lv->segments[si];
-        if (pu.z >= seg.startZ && pu.z <= seg.startZ + seg.length) {
-          if (std::abs(pu.x - seg.xOffset) < seg.width * 0.5f) {
-            groundY = seg.topY;
-            break;
-          }
-        }
-      }
-      
-      // Stationary position on ground (no bobbing)
-      const float renderY = groundY + 0.2f;  // Small offset above ground
-      const float rotSpeed = 30.0f;  // Slower rotation (degrees per second)
-      const float currentRot = pu.rotation + simTime * rotSpeed;
-      
-      // Scale pulsing animation (breathing effect)
-      const float scalePulse = 1.0f + 0.15f * std::sin(simTime * 2.5f);
-      
-      // Determine distinct colors and shapes based on type
-      Color puColor;
-      Color glowColor;
-      Color ringColor;
-      float iconSize = 0.6f;
-      bool useSphere = false;
-      bool usePyramid = false;
-      bool useCylinder = false;
-      
-      switch (pu.type) {
-        case PowerUpType::Shield:
-          puColor = Color{100, 220, 255, 255};  // Bright cyan
-          glowColor = Color{150, 240, 255, 255};
-          ringColor = Color{200, 250, 255, 255};  // Very bright for rings
-          iconSize = 0.7f;
-          useSphere = true;
-          break;
-        case PowerUpType::ScoreMultiplier:
-          puColor = Color{100, 255, 180, 255};  // Bright green
-          glowColor = Color{150, 255, 220, 255};
-          ringColor = Color{200, 255, 240, 255};
-          iconSize = 0.65f;
-          useCylinder = true;
-          break;
-        case PowerUpType::SpeedBoostShield:
-          puColor = Color{220, 150, 255, 255};  // Bright purple
-          glowColor = Color{240, 180, 255, 255};
-          ringColor = Color{250, 220, 255, 255};
-          iconSize = 0.75f;
-          usePyramid = true;
-          break;
-        case PowerUpType::SpeedBoostGhost:
-          puColor = Color{255, 220, 100, 255};  // Bright orange
-          glowColor = Color{255, 240, 150, 255};
-          ringColor = Color{255, 250, 200, 255};
-          iconSize = 0.7f;
-          useSphere = true;
-          break;
-        case PowerUpType::ObstacleReveal:
-          puColor = Color{255, 255, 120, 255};  // Bright yellow
-          glowColor = Color{255, 255, 200, 255};
-          ringColor = Color{255, 255, 240, 255};
-          iconSize = 0.65f;
-          useCylinder = true;
-          break;
-        case PowerUpType::SpeedDrain:
-          puColor = Color{255, 100, 100, 255};  // Bright red
-          glowColor = Color{255, 180, 180, 255};
-          ringColor = Color{255, 220, 220, 255};
-          iconSize = 0.7f;
-          usePyramid = true;
-          break;
-        case PowerUpType::ObstacleSurge:
-          puColor = Color{255, 140, 0, 255};  // Bright orange-red
-          glowColor = Color{255, 200, 100, 255};
-          ringColor = Color{255, 230, 150, 255};
-          iconSize = 0.75f;
-          useSphere = true;
-          break;
-        default:
-          puColor = Color{200, 200, 200, 255};
-          glowColor = Color{220, 220, 220, 255};
-          ringColor = Color{240, 240, 240, 255};
-          break;
-      }
-      
-      // Strong pulsing glow effect (much more intense)
-      const float glowPulse = 0.7f + 0.3f * std::sin(simTime * 3.5f);
-      const float outerGlowSize = iconSize * scalePulse * (2.8f + 0.5f * glowPulse);
-      const float middleGlowSize = iconSize * scalePulse * (2.2f + 0.3f * glowPulse);
-      const float innerGlowSize = iconSize * scalePulse * 1.6f;
-      const float coreGlowSize = iconSize * scalePulse * 1.2f;
-      
-      rlPushMatrix();
-      rlTranslatef(pu.x, renderY, pu.z);
-      
-      // Rotating rings (multiple layers for dramatic effect)
-      const float ringRot1 = simTime * 60.0f;  // Fast rotation
-      const float ringRot2 = simTime * -45.0f;  // Counter-rotation
-      const float ringSize1 = iconSize * scalePulse * 1.5f;
-      const float ringSize2 = iconSize * scalePulse * 1.8f;
-      
-      // Outer ring (largest, brightest)
-      rlPushMatrix();
-      rlRotatef(ringRot1, 0.0f, 1.0f, 0.0f);
-      DrawCubeV({0.0f, 0.0f, 0.0f}, {ringSize2, 0.1f, ringSize2},
-                ringColor);  // Full opacity ring
-      DrawCubeV({0.0f, 0.0f, 0.0f}, {ringSize2 * 1.1f, 0.05f, ringSize2 * 1.1f},
-                Fade(ringColor, 0.6f));
-      rlPopMatrix();
-      
-      // Middle ring
-      rlPushMatrix();
-      rlRotatef(ringRot2, 0.0f, 1.0f, 0.0f);
-      DrawCubeV({0.0f, 0.0f, 0.0f}, {ringSize1, 0.08f, ringSize1},
-                Fade(ringColor, 0.9f));
-      rlPopMatrix();
-      
-      // Multi-layer glow (4 layers for maximum visibility)
-      // Outer glow (largest, most transparent)
-      DrawCubeV({0.0f, 0.0f, 0.0f}, {outerGlowSize, outerGlowSize, outerGlowSize},
-                Fade(glowColor, 0.7f * glowPulse));
-      
-      // Middle glow
-      DrawCubeV({0.0f, 0.0f, 0.0f}, {middleGlowSize, middleGlowSize, middleGlowSize},
-                Fade(glowColor, 0.8f * glowPulse));
-      
-      // Inner glow
-      DrawCubeV({0.0f, 0.0f, 0.0f}, {innerGlowSize, innerGlowSize, innerGlowSize},
-                Fade(glowColor, 0.9f * glowPulse));
-      
-      // Core glow (brightest)
-      DrawCubeV({0.0f, 0.0f, 0.0f}, {coreGlowSize, coreGlowSize, coreGlowSize},
-                glowColor);  // Full opacity
-      
-      // Rotate the main icon
-      rlRotatef(currentRot, 0.0f, 1.0f, 0.0f);
-      
-      // Main icon with distinct shapes (fully opaque, no wireframes)
-      const float scaledSize = iconSize * scalePulse;
-      if (useSphere) {
-        // Sphere shape - solid glowing sphere
-        DrawCubeV({0.0f, 0.0f, 0.0f}, {scaledSize, scaledSize, scaledSize},
-                  puColor);  // Full opacity
-        // White highlight for emissive look
-        DrawCubeV({0.0f, scaledSize * 0.3f, -scaledSize * 0.3f}, 
-                  {scaledSize * 0.4f, scaledSize * 0.4f, scaledSize * 0.4f},
-                  Color{255, 255, 255, 200});
-      } else if (usePyramid) {
-        // Pyramid shape - solid glowing pyramid
-        const float baseH = scaledSize * 0.6f;
-        DrawCubeV({0.0f, -scaledSize * 0.3f, 0.0f}, {scaledSize, baseH, scaledSize},
-                  puColor);
-        DrawCubeV({0.0f, scaledSize * 0.2f, 0.0f}, {scaledSize * 0.5f, scaledSize * 0.4f, scaledSize * 0.5f},
-                  glowColor);
-        // White highlight
-        DrawCubeV({0.0f, scaledSize * 0.25f, -scaledSize * 0.2f},
-                  {scaledSize * 0.3f, scaledSize * 0.2f, scaledSize * 0.3f},
-                  Color{255, 255, 255, 180});
-      } else if (useCylinder) {
-        // Cylinder shape - solid glowing pill
-        DrawCubeV({0.0f, 0.0f, 0.0f}, {scaledSize, scaledSize * 0.8f, scaledSize},
-                  puColor);
-        DrawCubeV({0.0f, scaledSize * 0.35f, 0.0f}, {scaledSize * 0.9f, scaledSize * 0.2f, scaledSize * 0.9f},
-                  glowColor);
-        DrawCubeV({0.0f, -scaledSize * 0.35f, 0.0f}, {scaledSize * 0.9f, scaledSize * 0.2f, scaledSize * 0.9f},
-                  glowColor);
-        // White highlight
-        DrawCubeV({0.0f, scaledSize * 0.3f, -scaledSize * 0.3f},
-                  {scaledSize * 0.5f, scaledSize * 0.15f, scaledSize * 0.5f},
-                  Color{255, 255, 255, 200});
-      } else {
-        // Default cube - solid glowing cube
-        DrawCubeV({0.0f, 0.0f, 0.0f}, {scaledSize, scaledSize, scaledSize},
-                  puColor);
-        // White highlight
-        DrawCubeV({0.0f, scaledSize * 0.3f, -scaledSize * 0.3f},
-                  {scaledSize * 0.4f, scaledSize * 0.4f, scaledSize * 0.4f},
-                  Color{255, 255, 255, 200});
-      }
-      
-      // Glowing base/pedestal on the ground
-      DrawCubeV({0.0f, -renderY + groundY + 0.05f, 0.0f},
-                {scaledSize * 1.2f, 0.1f, scaledSize * 1.2f},
-                Fade(glowColor, 0.8f * glowPulse));
-      
-      // Vertical glow beam (makes them stand out even more)
-      const float beamHeight = scaledSize * 0.8f;
-      DrawCubeV({0.0f, renderY + beamHeight * 0.5f, 0.0f},
-                {scaledSize * 0.3f, beamHeight, scaledSize * 0.3f},
-                Fade(glowColor, 0.5f * glowPulse));
-      
-      rlPopMatrix();
-      
-      // Particle sparkles (simple orbiting particles)
-      const int sparkleCount = 8;
-      constexpr float kPi = 3.14159265359f;
-      for (int s = 0; s < sparkleCount; ++s) {
-        const float sparkleAngleRad = simTime * 2.0f + s * (2.0f * kPi / sparkleCount);
-        const float sparkleRadius = iconSize * scalePulse * 1.3f;
-        const float sparkleX = pu.x + std::cos(sparkleAngleRad) * sparkleRadius;
-        const float sparkleZ = pu.z + std::sin(sparkleAngleRad) * sparkleRadius;
-        const float sparkleY = renderY + 0.3f + 0.2f * std::sin(simTime * 4.0f + s);
-        const float sparkleSize = 0.08f + 0.05f * std::sin(simTime * 5.0f + s);
-        
-        DrawCubeV({sparkleX, sparkleY, sparkleZ}, {sparkleSize, sparkleSize, sparkleSize},
-                  Fade(ringColor, 0.9f));
-      }
-    }
-    
+    render::SetDrawPass(render::DrawPass::PowerUps);
+    render::RenderPowerUps(*lv, playerRenderPos, simTime);
+
     // Obstacle reveal visualization
+    render::SetDrawPass(render::DrawPass::Obstacles);
     if (game.obstacleRevealActive && lv) {
       const float revealRange = cfg::kObstacleRevealRange;
       const float revealStartZ = playerRenderPos.z;
@@ -760,16 +614,21 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
         const Color revealColor = Color{255, 255, 100, static_cast<unsigned char>(255 * pulse)};
         const Vector3 obSize = {ob.sizeX * 1.2f, ob.sizeY * 1.2f, ob.sizeZ * 1.2f};
         
-        DrawCubeWiresV({ob.x, ob.y + ob.sizeY * 0.5f, ob.z}, obSize, revealColor);
+        render::BatchCubeWires({ob.x, ob.y + ob.sizeY * 0.5f, ob.z}, obSize,
+                               revealColor);
         // Add glow effect
-        DrawCubeV({ob.x, ob.y + ob.sizeY * 0.5f, ob.z}, 
-                  {ob.sizeX * 1.3f, ob.sizeY * 1.3f, ob.sizeZ * 1.3f},
-                  Fade(revealColor, 0.1f * pulse));
+        render::BatchCube({ob.x, ob.y + ob.sizeY * 0.5f, ob.z},
+                          {ob.sizeX * 1.3f, ob.sizeY * 1.3f, ob.sizeZ * 1.3f},
+                          Fade(revealColor, 0.1f * pulse));
       }
     }
 
-    render::RenderStartLine(*lv, playerRenderPos, pal, simTime);
-    render::RenderFinishLine(*lv, playerRenderPos, pal, simTime);
+    render::SetDrawPass(render::DrawPass::Level);
+    render::RenderStartLine(*lv, playerRenderPos, pal, game.paletteIndex,
+                            simTime);
+    render::RenderFinishLine(*lv, playerRenderPos, pal, game.paletteIndex,
+                             simTime);
+    render::FlushCubeBatch();
   } // if (lv)
 
   // ── Scrolling track bands ─────────────────────────────────────────────────
@@ -790,9 +649,9 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
         const float nearT =
             1.0f - static_cast<float>(i) / static_cast<float>(kTrackBandCount);
         const float a = 0.06f + 0.18f * nearT + 0.18f * speedT;
-        DrawCubeV(Vector3{seg.xOffset, sGuideY + 0.01f, z},
-                  Vector3{seg.width * 0.85f, 0.015f, 0.2f},
-                  Fade(pal.laneGlow, a));
+        render::BatchCube(Vector3{seg.xOffset, sGuideY + 0.01f, z},
+                          Vector3{seg.width * 0.85f, 0.015f, 0.2f},
+                          Fade(pal.laneGlow, a));
       }
     }
   }
@@ -832,10 +691,12 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
   }
 
   // Decorative cubes, ambient dots
+  render::SetDrawPass(render::DrawPass::Space);
   render::RenderDecoCubes(pal, playerRenderPos, simTime);
   render::RenderAmbientDots(pal, playerRenderPos, simTime);
 
   // ── Player ship ───────────────────────────────────────────────────────────
+  render::SetDrawPass(render::DrawPass::Player);
   // ── Player ship shadow ────────────────────────────────────────────────────
   float groundY = cfg::kPlatformTopY;
   if (lv) {
@@ -851,15 +712,17 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
   if (shadowAlpha > 0.01f) {
     const float shadowBaseScale = 1.0f + altitude * 0.4f;
     // Inner tighter blob
-    DrawCubeV(Vector3{playerRenderPos.x, groundY + 0.015f, playerRenderPos.z},
-              Vector3{cfg::kPlayerWidth * 2.5f * shadowBaseScale, 0.005f,
-                      cfg::kPlayerDepth * 2.5f * shadowBaseScale},
-              Fade(BLACK, 0.5f * shadowAlpha));
+    render::BatchCube(
+        Vector3{playerRenderPos.x, groundY + 0.015f, playerRenderPos.z},
+        Vector3{cfg::kPlayerWidth * 2.5f * shadowBaseScale, 0.005f,
+                cfg::kPlayerDepth * 2.5f * shadowBaseScale},
+        Fade(BLACK, 0.5f * shadowAlpha));
     // Outer softer blob
-    DrawCubeV(Vector3{playerRenderPos.x, groundY + 0.01f, playerRenderPos.z},
-              Vector3{cfg::kPlayerWidth * 4.5f * shadowBaseScale, 0.005f,
-                      cfg::kPlayerDepth * 4.5f * shadowBaseScale},
-              Fade(BLACK, 0.25f * shadowAlpha));
+    render::BatchCube(
+        Vector3{playerRenderPos.x, groundY + 0.01f, playerRenderPos.z},
+        Vector3{cfg::kPlayerWidth * 4.5f * shadowBaseScale, 0.005f,
+                cfg::kPlayerDepth * 4.5f * shadowBaseScale},
+        Fade(BLACK, 0.25f * shadowAlpha));
   }
 
   // ── Player effect glow (power-ups/debuffs) ──────────────────────────────────
@@ -942,23 +805,27 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
     };
     
     // Outer glow (larger, more transparent)
-    DrawCubeV(glowPos, glowSizeVec, Fade(effectGlowColor, 0.3f * effectGlowAlpha));
+    render::BatchCube(glowPos, glowSizeVec,
+                      Fade(effectGlowColor, 0.3f * effectGlowAlpha));
     
     // Inner glow (tighter, brighter)
-    DrawCubeV(glowPos, {
+    render::BatchCube(glowPos, {
       glowSizeVec.x * 0.7f,
       glowSizeVec.y * 0.7f,
       glowSizeVec.z * 0.7f
     }, Fade(effectGlowColor, 0.6f * effectGlowAlpha));
     
     // Core glow (brightest)
-    DrawCubeV(glowPos, {
+    render::BatchCube(glowPos, {
       glowSizeVec.x * 0.5f,
       glowSizeVec.y * 0.5f,
       glowSizeVec.z * 0.5f
     }, Fade(effectGlowColor, 0.8f * effectGlowAlpha));
   }
 
+  // The ship draws outside the batch; emit everything queued behind it first.
+  render::FlushCubeBatch();
+
   if (g_shipLoaded) {
     const float scale = cfg::kShipModelScale;
     const Vector3 shipPos = {playerRenderPos.x,
@@ -969,17 +836,18 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
     DrawModelWiresEx(g_shipModel, shipPos, {0.0f, 1.0f, 0.0f}, 180.0f,
                      {scale, scale, scale}, Fade(pal.neonEdgeGlow, 0.6f));
   } else {
-    DrawCubeV(
+    render::BatchCube(
         playerRenderPos,
         {cfg::kPlayerWidth, cfg::kPlayerHalfHeight * 2.0f, cfg::kPlayerDepth},
         pal.playerBody);
-    DrawCubeWiresV(
+    render::BatchCubeWires(
         playerRenderPos,
         {cfg::kPlayerWidth, cfg::kPlayerHalfHeight * 2.0f, cfg::kPlayerDepth},
         pal.playerWire);
   }
 
   // ── Engine exhaust ────────────────────────────────────────────────────────
+  render::SetDrawPass(render::DrawPass::Particles);
   {
     static uint32_t exhaustRng = 12345u;
     const Vector3 exhaustOrigin = {
@@ -987,36 +855,38 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
         playerRenderPos.z - cfg::kPlayerDepth * 0.5f * cfg::kShipModelScale -
             0.1f};
     const int spawnCount = 2 + static_cast<int>(speedT * 2.0f);
+    g_exhaust.Update(kExhaustMotion, renderDt);
     for (int i = 0; i < spawnCount; ++i) {
-      SpawnExhaustParticle(exhaustOrigin, planarSpeed - cfg::kForwardSpeed,
-                           exhaustRng);
+      EmitExhaust(exhaustOrigin, planarSpeed - cfg::kForwardSpeed,
+                  exhaustRng);
     }
-    UpdateExhaustParticles(renderDt);
 
-    for (const auto &ep : g_exhaust) {
-      if (!ep.active)
-        continue;
-      const float lifeT = render::Clamp01(ep.life / ep.maxLife);
+    for (int i = 0; i < g_exhaust.count; ++i) {
+      const float lifeT =
+          render::Clamp01(g_exhaust.life[i] / g_exhaust.maxLife[i]);
       const float sz = 0.04f + 0.1f * lifeT;
-      DrawCubeV(ep.pos, {sz, sz, sz * 1.5f},
-                Color{255,
-                      static_cast<unsigned char>(140 + 100 * (1.0f - lifeT)),
-                      30, static_cast<unsigned char>(220 * lifeT)});
+      render::BatchCube(
+          g_exhaust.Position(i), {sz, sz, sz * 1.5f},
+          Color{255, static_cast<unsigned char>(140 + 100 * (1.0f - lifeT)),
+                30, static_cast<unsigned char>(220 * lifeT)});
     }
-    DrawCubeV({exhaustOrigin.x, exhaustOrigin.y, exhaustOrigin.z - 0.3f},
-              {0.4f + 0.2f * speedT, 0.2f, 0.6f + 0.4f * speedT},
-              Fade(Color{255, 160, 40, 255}, 0.15f + 0.1f * speedT));
+    render::BatchCube(
+        {exhaustOrigin.x, exhaustOrigin.y, exhaustOrigin.z - 0.3f},
+        {0.4f + 0.2f * speedT, 0.2f, 0.6f + 0.4f * speedT},
+        Fade(Color{255, 160, 40, 255}, 0.15f + 0.1f * speedT));
   }
 
   // ── Landing particles ─────────────────────────────────────────────────────
-  for (const auto &p : game.landingParticles) {
-    if (!p.active)
-      continue;
-    const float lifeT = render::Clamp01(p.life / cfg::kLandingParticleLife);
-    DrawCubeV(p.position, {0.08f, 0.08f, 0.08f}, Fade(pal.particle, lifeT));
+  for (int i = 0; i < game.particles.count; ++i) {
+    const float lifeT =
+        render::Clamp01(game.particles.life[i] / cfg::kLandingParticleLife);
+    render::BatchCube(game.particles.Position(i), {0.08f, 0.08f, 0.08f},
+                      Fade(pal.particle, lifeT));
   }
 
+  render::FlushCubeBatch();
   EndMode3D();
+  render::SetDrawPass(render::DrawPass::Hud);
 
   // Always reset viewport to full screen for 2D rendering after 3D
   rlViewport(0, 0, cfg::kScreenWidth, cfg::kScreenHeight);
@@ -1025,85 +895,8 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
   }
 
   // ── Power-up text labels (2D rendering) ────────────────────────────────────
-  if (game.screen == GameScreen::Playing && lv) {
-    for (int pi = 0; pi < lv->powerUpCount; ++pi) {
-      const auto &pu = lv->powerUps[pi];
-      if (!pu.active) continue;
-      if (std::fabs(pu.z - playerRenderPos.z) > 60.0f) continue;
-      
-      const char* label = GetPowerUpLabel(pu.type);
-      if (!label || label[0] == '\0') continue;
-      
-      // Find ground level (same as in 3D rendering)
-      float groundY = pu.y;
-      for (int si = 0; si < lv->segmentCount; ++si) {
-        const auto &seg = lv->segments[si];
-        if (pu.z >= seg.startZ && pu.z <= seg.startZ + seg.length) {
-          if (std::abs(pu.x - seg.xOffset) < seg.width * 0.5f) {
-            groundY = seg.topY;
-            break;
-          }
-        }
-      }
-      
-      // Text position directly above power-up (no bobbing)
-      const float textY = groundY + 0.2f + 0.8f;  // Above the icon
-      
-      // Convert world position to screen coordinates
-      Vector3 textPos = {pu.x, textY, pu.z};
-      Vector2 screenPos = GetWorldToScreen(textPos, game.camera);
-      
-      // Only render if on screen and in front of camera
-      if (screenPos.x >= 0 && screenPos.x < cfg::kScreenWidth &&
-          screenPos.y >= 0 && screenPos.y < cfg::kScreenHeight &&
-          textPos.z > playerRenderPos.z - 5.0f) {
-        const float textPulse = 1.0f + 0.15f * std::sin(simTime * cfg::kPowerUpTextPulseSpeed);
-        const int fontSize = static_cast<int>(18.0f * textPulse);  // Larger text
-        
-        // Determine color based on type (match the icon colors)
-        Color textColor;
-        switch (pu.type) {
-          case PowerUpType::Shield:
-            textColor = Color{100, 200, 255, 255};
-            break;
-          case PowerUpType::ScoreMultiplier:
-            textColor = Color{100, 255, 150, 255};
-            break;
-          case PowerUpType::SpeedBoostShield:
-            textColor = Color{200, 150, 255, 255};
-            break;
-          case PowerUpType::SpeedBoostGhost:
-            textColor = Color{255, 200, 100, 255};
-            break;
-          case PowerUpType::ObstacleReveal:
-            textColor = Color{255, 255, 100, 255};
-            break;
-          case PowerUpType::SpeedDrain:
-            textColor = Color{255, 80, 80, 255};
-            break;
-          case PowerUpType::ObstacleSurge:
-            textColor = Color{255, 120, 0, 255};
-            break;
-          default:
-            textColor = Color{200, 200, 200, 255};
-            break;
-        }
-        
-        // Draw text with stronger outline for visibility
-        const int outlineWidth = 2;
-        for (int ox = -outlineWidth; ox <= outlineWidth; ++ox) {
-          for (int oy = -outlineWidth; oy <= outlineWidth; ++oy) {
-            if (ox != 0 || oy != 0) {
-              DrawText(label, static_cast<int>(screenPos.x) + ox, 
-                      static_cast<int>(screenPos.y) + oy, fontSize, BLACK);
-            }
-          }
-        }
-        DrawText(label, static_cast<int>(screenPos.x), 
-                static_cast<int>(screenPos.y), fontSize, textColor);
-      }
-    }
-  }
+  if (game.screen == GameScreen::Playing && lv)
+    render::RenderPowerUpLabels(*lv, game.camera, playerRenderPos, simTime);
 
   // ── Bloom overlay ─────────────────────────────────────────────────────────
   if (game.bloomEnabled) {
@@ -1491,7 +1284,9 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
   }
 
   // ── Perf overlay ─────────────────────────────────────────────────────────
-  {
+  if (game.perfOverlayVisible) {
+    render::RenderPerfOverlay(game, pal);
+  } else {
     const int perfY = cfg::kScreenHeight - 52;
     DrawRectangleRounded({10.0f, static_cast<float>(perfY), 310.0f, 42.0f},
                          0.08f, 8, pal.uiPanel);
@@ -1514,11 +1309,12 @@ void RenderFrame(Game &game, float alpha, float renderDt) {
     DrawRectangleRounded(
         {static_cast<float>(notifX), 60.0f, static_cast<float>(notifW), 50.0f},
         0.1f, 8, Fade(pal.uiPanel, alpha * 0.95f));
-    DrawText("Screenshot saved!", notifX + 20, 68, 20,
+    DrawText(game.screenshotNotificationTitle, notifX + 20, 68, 20,
              Fade(pal.uiAccent, alpha));
     DrawText(game.screenshotPath, notifX + 20, 90, 14,
              Fade(pal.uiText, alpha * 0.8f));
   }
 
-  EndDrawing();
+  render::EndFrame();
+  render::EndDrawStatsFrame();
 }
@@ -2,9 +2,14 @@
 
 #include <cstdint>
 
+#include "core/ParticleSystem.hpp"
+
 struct Game;
 
 void InitRenderer();
 void CleanupRenderer();
 void RenderFrame(Game& game, float alpha, float renderDt);
 void RegenerateSpaceObjects(uint32_t seed);
+
+// Engine exhaust pool usage, for the perf overlay.
+core::ParticleStats GetExhaustParticleStats();
@@ -3,6 +3,8 @@
 #include <cmath>
 
 #include "core/Config.hpp"
+#include "render/CubeBatch.hpp"
+#include "render/Frustum.hpp"
 #include "render/Palette.hpp"
 #include "render/RenderUtils.hpp"
 
@@ -106,6 +108,7 @@ void InitSceneDressing() {
 // ───────────────────────────────────────────────────────────────────
 
 void RenderMountains(const LevelPalette &pal, const Vector3 &playerRenderPos) {
+  BoxBatch<cfg::kMountainCount> bounds;
   for (int i = 0; i < cfg::kMountainCount; ++i) {
     const Mountain &m = g_mountains[i];
     const float rad = m.angle * DEG2RAD;
@@ -113,33 +116,55 @@ void RenderMountains(const LevelPalette &pal, const Vector3 &playerRenderPos) {
         std::sin(rad) * cfg::kMountainDistance + playerRenderPos.x * 0.02f,
         -2.0f,
         std::cos(rad) * cfg::kMountainDistance + playerRenderPos.z * 0.05f};
-    DrawCubeV(base, Vector3{m.width, m.height, m.width * 0.5f},
+    bounds.Add(i, base,
+               Vector3{m.width * 0.5f, m.height * 0.5f, m.width * 0.25f});
+  }
+  bounds.Cull();
+
+  for (int k = 0; k < bounds.count; ++k) {
+    if (!bounds.visible[k])
+      continue;
+    const Mountain &m = g_mountains[bounds.id[k]];
+    BatchCube(Vector3{bounds.x[k], bounds.y[k], bounds.z[k]},
+              Vector3{m.width, m.height, m.width * 0.5f},
               pal.mountainSilhouette);
   }
 }
 
 void RenderDecoCubes(const LevelPalette &pal, const Vector3 &playerRenderPos,
                      float simTime) {
+  // Bounds reach from the ground halo up to the bobbing cube.
+  SphereBatch<cfg::kDecoCubeCount> bounds;
   for (int i = 0; i < cfg::kDecoCubeCount; ++i) {
     const DecoCube &dc = g_decoCubes[i];
     if (std::fabs(dc.pos.z - playerRenderPos.z) > 60.0f)
       continue;
+    bounds.Add(i, dc.pos,
+               dc.size * 1.2f + std::fabs(dc.pos.y - cfg::kPlatformTopY) +
+                   0.4f);
+  }
+  bounds.Cull();
 
+  for (int k = 0; k < bounds.count; ++k) {
+    if (!bounds.visible[k])
+      continue;
+    const DecoCube &dc = g_decoCubes[bounds.id[k]];
     const float bob = std::sin(simTime * dc.rotSpeed * 0.03f + dc.pos.x) * 0.4f;
     const Vector3 pos = {dc.pos.x, dc.pos.y + bob, dc.pos.z};
     const Color col = GetDecoCubeColor(pal, dc.colorIndex);
 
     // Glow halo on ground beneath cube.
-    DrawCubeV(Vector3{dc.pos.x, cfg::kPlatformTopY + 0.03f, dc.pos.z},
+    BatchCube(Vector3{dc.pos.x, cfg::kPlatformTopY + 0.03f, dc.pos.z},
               Vector3{dc.size * 1.6f, 0.01f, dc.size * 1.6f}, Fade(col, 0.15f));
-    DrawCubeWiresV(pos, Vector3{dc.size, dc.size, dc.size}, col);
-    DrawCubeV(pos, Vector3{dc.size * 0.7f, dc.size * 0.7f, dc.size * 0.7f},
+    BatchCubeWires(pos, Vector3{dc.size, dc.size, dc.size}, col);
+    BatchCube(pos, Vector3{dc.size * 0.7f, dc.size * 0.7f, dc.size * 0.7f},
               Fade(col, 0.25f));
   }
 }
 
 void RenderAmbientDots(const LevelPalette &pal, const Vector3 &playerRenderPos,
                        float simTime) {
+  SphereBatch<cfg::kAmbientParticleCount> bounds;
   for (int i = 0; i < cfg::kAmbientParticleCount; ++i) {
     const AmbientDot &d = g_ambientDots[i];
 
@@ -151,9 +176,17 @@ void RenderAmbientDots(const LevelPalette &pal, const Vector3 &playerRenderPos,
 
     if (std::fabs(pos.z - playerRenderPos.z) > 50.0f)
       continue;
+    bounds.Add(i, pos, 0.05f);
+  }
+  bounds.Cull();
 
-    DrawCubeV(
-        pos, Vector3{0.05f, 0.05f, 0.05f},
+  for (int k = 0; k < bounds.count; ++k) {
+    if (!bounds.visible[k])
+      continue;
+    const AmbientDot &d = g_ambientDots[bounds.id[k]];
+    BatchCube(
+        Vector3{bounds.x[k], bounds.y[k], bounds.z[k]},
+        Vector3{0.05f, 0.05f, 0.05f},
         Fade(pal.ambientParticle, 0.4f + 0.3f * std::sin(simTime + d.phase)));
   }
 }
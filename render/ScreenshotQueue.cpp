@@ -0,0 +1,105 @@
+#include "render/ScreenshotQueue.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include <raylib.h>
+
+#include "core/Config.hpp"
+#include "render/FrameTarget.hpp"
+#include "render/ReadbackQueue.hpp"
+
+namespace render {
+
+namespace {
+
+// What to write for each queue slot; belongs to whoever owns the slot.
+ScreenshotRequest g_requests[cfg::kScreenshotQueueSlots];
+
+ReadbackQueue g_queue(cfg::kScreenshotQueueSlots);
+
+bool WriteSidecar(const ScreenshotRequest &request) {
+  std::FILE *file = std::fopen(request.sidecarPath.c_str(), "wb");
+  if (!file)
+    return false;
+  const size_t size = request.sidecarText.size();
+  const bool ok =
+      std::fwrite(request.sidecarText.data(), 1, size, file) == size;
+  return std::fclose(file) == 0 && ok;
+}
+
+// Screenshots are opaque, so alpha is dropped and RGB8 written.
+bool WriteSlot(int index) {
+  ReadbackSlot &slot = g_queue.slots[index];
+  PackRgb(slot.pixels.data(), slot.width * slot.height);
+  const ScreenshotRequest &request = g_requests[index];
+  Image image = {slot.pixels.data(), slot.width, slot.height, 1,
+                 PIXELFORMAT_UNCOMPRESSED_R8G8B8};
+
+  bool ok = false;
+  const bool resize =
+      request.outputWidth > 0 && request.outputHeight > 0 &&
+      (request.outputWidth != slot.width ||
+       request.outputHeight != slot.height);
+  if (resize) {
+    // ImageResize reallocates, so it must not touch the pooled buffer.
+    Image scaled = ImageCopy(image);
+    ImageResize(&scaled, request.outputWidth, request.outputHeight);
+    ok = ExportImage(scaled, request.path.c_str());
+    UnloadImage(scaled);
+  } else {
+    ok = ExportImage(image, request.path.c_str());
+  }
+  if (ok && !request.sidecarPath.empty())
+    ok = WriteSidecar(request);
+  return ok;
+}
+
+void Submit(int index, ScreenshotRequest &&request) {
+  g_requests[index] = std::move(request);
+  StartReadbackWriter(g_queue, WriteSlot);
+  SubmitReadbackSlot(g_queue, index);
+}
+
+} // namespace
+
+void CaptureScreenshot(ScreenshotRequest request) {
+  int width = 0;
+  int height = 0;
+  GetFrameSize(width, height);
+  if (width <= 0 || height <= 0)
+    return;
+
+  const int index = AcquireReadbackSlot(g_queue, width, height);
+  if (!ReadFramePixels(g_queue.slots[index].pixels.data(), width, height)) {
+    ReleaseReadbackSlot(g_queue, index);
+    return;
+  }
+  Submit(index, std::move(request));
+}
+
+void QueueScreenshotPixels(ScreenshotRequest request,
+                           const unsigned char *rgba, int width, int height) {
+  if (!rgba || width <= 0 || height <= 0)
+    return;
+  const int index = AcquireReadbackSlot(g_queue, width, height);
+  std::memcpy(g_queue.slots[index].pixels.data(), rgba,
+              static_cast<size_t>(width) * height * 4);
+  Submit(index, std::move(request));
+}
+
+void FlushScreenshots() { FlushReadbacks(g_queue); }
+
+void ShutdownScreenshotQueue() {
+  StopReadbackWriter(g_queue);
+  for (ScreenshotRequest &request : g_requests)
+    request = {};
+}
+
+ScreenshotQueueStats GetScreenshotQueueStats() {
+  const ReadbackStats stats = GetReadbackStats(g_queue);
+  return {stats.pending, stats.written, stats.failed, stats.stalls};
+}
+
+} // namespace render
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+
+// Asynchronous screenshot writer.
+//
+// The main thread only reads the frame back into one of
+// cfg::kScreenshotQueueSlots pooled pixel buffers; a worker thread encodes
+// it and writes the file, plus an optional text sidecar. The encoder
+// follows the file extension (.png, .qoi, or .raw for headerless RGB8).
+// When every buffer is still waiting on the worker, a capture blocks until
+// one frees up, so a burst of captures never grows memory without bound.
+//
+// Captures are submitted from the main thread only.
+
+namespace render {
+
+struct ScreenshotRequest {
+  std::string path;
+  int outputWidth = 0; // 0 keeps the captured size
+  int outputHeight = 0;
+  std::string sidecarPath; // Written after the image if non-empty
+  std::string sidecarText;
+};
+
+struct ScreenshotQueueStats {
+  int pending = 0; // Captured, not written yet
+  int written = 0;
+  int failed = 0;
+  int stalls = 0; // Captures that waited for a free buffer
+};
+
+// Read back the frame RenderFrame just finished (the offscreen frame target
+// if one is set, else the window) and queue it.
+void CaptureScreenshot(ScreenshotRequest request);
+
+// Queue top-down RGBA8 pixels that are already in memory.
+void QueueScreenshotPixels(ScreenshotRequest request,
+                           const unsigned char *rgba, int width, int height);
+
+// Block until every queued screenshot is on disk.
+void FlushScreenshots();
+
+// Flush, then stop the worker thread. Renderer shutdown only.
+void ShutdownScreenshotQueue();
+
+ScreenshotQueueStats GetScreenshotQueueStats();
+
+} // namespace render
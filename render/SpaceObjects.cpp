@@ -3,7 +3,10 @@
 #include <cmath>
 
 #include "core/Config.hpp"
+#include "render/CubeBatch.hpp"
+#include "render/Frustum.hpp"
 #include "render/Palette.hpp"
+#include "render/Prefab.hpp"
 #include "render/RenderUtils.hpp"
 
 namespace render {
@@ -11,7 +14,7 @@ namespace render {
 // ─── Types
 // ────────────────────────────────────────────────────────────────────
 
-enum class SpaceObjectType { Star, Planet, Asteroid, Comet, Nebula };
+enum class SpaceObjectType { Planet, Asteroid, Comet, Nebula };
 
 struct SpaceObject {
   Vector3 basePos;
@@ -36,8 +39,17 @@ struct SpaceObject {
   // Visual
   int textureIndex;
   Color tint;
+};
+
+// Stars only twinkle and follow parallax, so they live in a static prefab:
+// twinkle is a per-vertex pulse, parallax one group offset per depth layer.
+struct Star {
+  Vector3 pos;
+  float brightness;
+  float size;
   float pulseRate;
   float pulseOffset;
+  int layer;
 };
 
 // ─── State
@@ -46,9 +58,21 @@ struct SpaceObject {
 static bool g_inited = false;
 static uint32_t g_seed = 0u;
 
-constexpr int kMaxSpaceObjects = cfg::kStarCount + 100;
+constexpr int kStarLayers = 3;
+constexpr float kStarParallax[kStarLayers] = {0.2f, 0.1f, 0.02f};
+static Star g_stars[cfg::kStarCount];
+static int g_starCount = 0;
+static Vector3 g_parallaxOrigin = {};
+static bool g_starPrefabBuilt = false;
+static bool g_starPrefabDirty = true;
+static Color g_starPrefabBright = {};
+static Color g_starPrefabDim = {};
+static Prefab g_starPrefab;
+
+constexpr int kMaxSpaceObjects = 100;
 static SpaceObject g_objects[kMaxSpaceObjects];
 static int g_count = 0;
+static SphereBatch<kMaxSpaceObjects> g_bounds;
 
 // Loaded via InitRenderer — forwarded in as extern to avoid a circular dep.
 // Declared extern so SpaceObjects.cpp can reference it from Render.cpp's TU.
@@ -90,6 +114,63 @@ static void ComputeOrbitalBasis(SpaceObject &obj, const Vector3 &axis) {
   obj.orbitalForward = forward;
 }
 
+// Cubes are bounded by half their diagonal, billboards by half of theirs,
+// and comets also cover their 3-unit tail.
+static float BoundingRadius(const SpaceObject &obj) {
+  switch (obj.type) {
+  case SpaceObjectType::Comet:
+    return obj.size + 3.0f;
+  case SpaceObjectType::Planet:
+  case SpaceObjectType::Nebula:
+    return obj.size * 0.71f;
+  default:
+    return obj.size * 0.87f;
+  }
+}
+
+static PrefabBuilder BuildStarField(const LevelPalette &pal) {
+  PrefabBuilder b;
+  for (int i = 0; i < g_starCount; ++i) {
+    const Star &star = g_stars[i];
+    // Fade(col, (0.5 + 0.5 sin) * brightness) as a pulse on opaque colour.
+    const Color col = (star.brightness > 0.7f) ? pal.starBright : pal.starDim;
+    const PrefabPulse twinkle = {star.pulseRate, star.pulseOffset,
+                                 0.5f * star.brightness,
+                                 0.5f * star.brightness};
+    b.AddBox(star.pos, {star.size, star.size, star.size},
+             Color{col.r, col.g, col.b, 255}, twinkle, star.layer);
+  }
+  return b;
+}
+
+static bool SameColor(Color a, Color b) {
+  return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+static void RenderStars(const LevelPalette &pal, float simTime) {
+  if (g_starPrefabBuilt &&
+      (g_starPrefabDirty || !SameColor(g_starPrefabBright, pal.starBright) ||
+       !SameColor(g_starPrefabDim, pal.starDim))) {
+    UnloadPrefab(g_starPrefab);
+    g_starPrefabBuilt = false;
+  }
+  if (!g_starPrefabBuilt) {
+    g_starPrefab = LoadPrefab(BuildStarField(pal));
+    g_starPrefabBuilt = true;
+    g_starPrefabDirty = false;
+    g_starPrefabBright = pal.starBright;
+    g_starPrefabDim = pal.starDim;
+  }
+
+  PrefabGroup layers[kStarLayers];
+  for (int l = 0; l < kStarLayers; ++l) {
+    layers[l].offset = {g_parallaxOrigin.x * kStarParallax[l], 0.0f,
+                        g_parallaxOrigin.z * kStarParallax[l] * 2.0f};
+  }
+  const PrefabInstance origin;
+  DrawPrefab(g_starPrefab, layers, kStarLayers, &origin, 1, simTime);
+}
+
 // ─── Public API
 // ───────────────────────────────────────────────────────────────
 
@@ -100,42 +181,28 @@ void RegenerateSpaceObjects(uint32_t seed) {
   uint32_t rng = seed;
 
   // Stars (Layered)
-  for (int i = 0; i < cfg::kStarCount && g_count < kMaxSpaceObjects; ++i) {
-    auto &obj = g_objects[g_count++];
-    obj.type = SpaceObjectType::Star;
+  g_starCount = 0;
+  for (int i = 0; i < cfg::kStarCount; ++i) {
+    auto &star = g_stars[g_starCount++];
 
     const uint32_t s = static_cast<uint32_t>(i) * 7919u + seed;
 
     // Distribute stars in 3 depth layers
     float layer = HashFloat01(s + 11u);
     float rangeScale = (layer < 0.3f) ? 0.5f : (layer < 0.8f) ? 1.0f : 1.5f;
-    float pFactor = (layer < 0.3f) ? 0.2f : (layer < 0.8f) ? 0.1f : 0.02f;
+    star.layer = (layer < 0.3f) ? 0 : (layer < 0.8f) ? 1 : 2;
+    const float pFactor = kStarParallax[star.layer];
 
-    obj.basePos = Vector3{
+    star.pos = Vector3{
         (HashFloat01(s) - 0.5f) * 2.0f * cfg::kStarFieldRadius * rangeScale,
         HashFloat01(s + 1u) * cfg::kStarFieldHeight * rangeScale + 2.0f,
         (HashFloat01(s + 2u) - 0.3f) * cfg::kStarFieldDepth * rangeScale};
-    obj.currentPos = obj.basePos;
-    obj.brightness = 0.2f + 0.8f * HashFloat01(s + 3u);
-    obj.size = (0.04f + HashFloat01(s + 4u) * 0.15f) * (2.0f - pFactor * 5.0f);
-
-    if (HashFloat01(s + 5u) > 0.85f) {
-      obj.velocity = {(HashFloat01(s + 6u) - 0.5f) * 0.3f,
-                      (HashFloat01(s + 7u) - 0.5f) * 0.2f,
-                      (HashFloat01(s + 8u) - 0.5f) * 0.1f};
-    } else {
-      obj.velocity = {0.0f, 0.0f, 0.0f};
-    }
-
-    obj.parallaxFactor = pFactor;
-    obj.orbitalRadius = 0.0f;
-    obj.orbitalSpeed = 0.0f;
-    obj.orbitalAngle = 0.0f;
-    obj.textureIndex = 0;
-    obj.tint = WHITE;
-    obj.pulseRate = 1.0f + HashFloat01(s + 10u) * 2.0f;
-    obj.pulseOffset = HashFloat01(s + 11u) * 10.0f;
+    star.brightness = 0.2f + 0.8f * HashFloat01(s + 3u);
+    star.size = (0.04f + HashFloat01(s + 4u) * 0.15f) * (2.0f - pFactor * 5.0f);
+    star.pulseRate = 1.0f + HashFloat01(s + 10u) * 2.0f;
+    star.pulseOffset = HashFloat01(s + 11u) * 10.0f;
   }
+  g_starPrefabDirty = true;
 
   // Comets
   for (int i = 0; i < cfg::kCometCount && g_count < kMaxSpaceObjects; ++i) {
@@ -269,6 +336,7 @@ void RegenerateSpaceObjects(uint32_t seed) {
 }
 
 void UpdateSpaceObjects(float dt, const Vector3 &playerPos) {
+  g_parallaxOrigin = playerPos;
   for (int i = 0; i < g_count; ++i) {
     auto &obj = g_objects[i];
 
@@ -303,19 +371,21 @@ void UpdateSpaceObjects(float dt, const Vector3 &playerPos) {
 
 void RenderSpaceObjects(const Camera3D &camera, const LevelPalette &pal,
                         float simTime) {
-  for (int i = 0; i < g_count; ++i) {
-    const auto &obj = g_objects[i];
-
-    if (obj.type == SpaceObjectType::Star) {
-      const float twinkle =
-          0.5f + 0.5f * std::sin(simTime * obj.pulseRate + obj.pulseOffset);
-      const Color col = (obj.brightness > 0.7f)
-                            ? Fade(pal.starBright, twinkle * obj.brightness)
-                            : Fade(pal.starDim, twinkle * obj.brightness);
-      DrawCubeV(obj.currentPos, Vector3{obj.size, obj.size, obj.size}, col);
-    } else if (obj.type == SpaceObjectType::Comet) {
+  RenderStars(pal, simTime);
+
+  g_bounds.Clear();
+  for (int i = 0; i < g_count; ++i)
+    g_bounds.Add(i, g_objects[i].currentPos, BoundingRadius(g_objects[i]));
+  g_bounds.Cull();
+
+  for (int k = 0; k < g_bounds.count; ++k) {
+    if (!g_bounds.visible[k])
+      continue;
+    const auto &obj = g_objects[g_bounds.id[k]];
+
+    if (obj.type == SpaceObjectType::Comet) {
       const Color headCol = Fade(obj.tint, obj.brightness);
-      DrawCubeV(obj.currentPos, Vector3{obj.size, obj.size, obj.size}, headCol);
+      BatchCube(obj.currentPos, Vector3{obj.size, obj.size, obj.size}, headCol);
 
       // Draw tail as series of fading particles
       Vector3 dir = {-obj.velocity.x, -obj.velocity.y, -obj.velocity.z};
@@ -328,7 +398,7 @@ void RenderSpaceObjects(const Camera3D &camera, const LevelPalette &pal,
                              obj.currentPos.y + dir.y * t * 3.0f,
                              obj.currentPos.z + dir.z * t * 3.0f};
           float tailSize = obj.size * (1.0f - t * 0.7f);
-          DrawCubeV(tailPos, {tailSize, tailSize, tailSize},
+          BatchCube(tailPos, {tailSize, tailSize, tailSize},
                     Fade(obj.tint, obj.brightness * (1.0f - t) * 0.4f));
         }
       }
@@ -351,11 +421,18 @@ void RenderSpaceObjects(const Camera3D &camera, const LevelPalette &pal,
           obj.currentPos, Vector2{obj.size, obj.size}, obj.tint);
     } else if (obj.type == SpaceObjectType::Asteroid) {
       const Color col = Fade(obj.tint, obj.brightness);
-      DrawCubeV(obj.currentPos, Vector3{obj.size, obj.size, obj.size}, col);
-      DrawCubeWiresV(obj.currentPos, Vector3{obj.size, obj.size, obj.size},
+      BatchCube(obj.currentPos, Vector3{obj.size, obj.size, obj.size}, col);
+      BatchCubeWires(obj.currentPos, Vector3{obj.size, obj.size, obj.size},
                      Fade(col, 0.6f));
     }
   }
 }
 
+void UnloadSpaceObjectPrefabs() {
+  if (g_starPrefabBuilt)
+    UnloadPrefab(g_starPrefab);
+  g_starPrefabBuilt = false;
+  g_starPrefabDirty = true;
+}
+
 } // namespace render
@@ -16,7 +16,12 @@ void RegenerateSpaceObjects(uint32_t seed);
 void UpdateSpaceObjects(float dt, const Vector3 &playerPos);
 
 // Draw all space objects (stars, planets, asteroids) in the current 3D mode.
+// The star field is one cached prefab draw, rebuilt on re-seed or when the
+// palette's star colours change.
 void RenderSpaceObjects(const Camera3D &camera, const LevelPalette &pal,
                         float simTime);
 
+// Free the cached star field. Renderer shutdown only.
+void UnloadSpaceObjectPrefabs();
+
 } // namespace render
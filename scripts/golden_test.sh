@@ -0,0 +1,92 @@
+#!/usr/bin/env bash
+# Golden-image render regression test.
+#
+# Renders every scene in tests/golden/scenes.txt headless with sim_runner and
+# compares it against tests/golden/images with golden_diff. Scenes render in
+# parallel, one sim_runner process each; golden_diff spreads the comparisons
+# across cores and writes heatmaps of the images that fail.
+#
+# Usage: ./scripts/golden_test.sh [build_dir] [--update]
+#   --update   Replace the goldens with fresh renders (review them first)
+#
+# Environment:
+#   GOLDEN_JOBS          Parallel renders (default: nproc)
+#   GOLDEN_OUTPUT_DIR    Renders and heatmaps (default: <build_dir>/golden)
+#   GOLDEN_DIFF_FLAGS    Extra golden_diff flags, e.g. "--max-diff 0.5"
+
+set -euo pipefail
+
+BUILD_DIR="build"
+UPDATE=0
+for arg in "$@"; do
+    case "${arg}" in
+        --update) UPDATE=1 ;;
+        *) BUILD_DIR="${arg}" ;;
+    esac
+done
+
+SCENES="tests/golden/scenes.txt"
+GOLDEN_DIR="tests/golden/images"
+OUTPUT_DIR="${GOLDEN_OUTPUT_DIR:-${BUILD_DIR}/golden}"
+JOBS="${GOLDEN_JOBS:-$(nproc 2>/dev/null || echo 4)}"
+read -r -a DIFF_FLAGS <<< "${GOLDEN_DIFF_FLAGS:-}"
+
+for tool in sim_runner golden_diff; do
+    if [[ ! -x "${BUILD_DIR}/${tool}" ]]; then
+        echo "${BUILD_DIR}/${tool} not found; build first (./scripts/build.sh ${BUILD_DIR})" >&2
+        exit 2
+    fi
+done
+
+ACTUAL_DIR="${OUTPUT_DIR}/actual"
+HEATMAP_DIR="${OUTPUT_DIR}/heatmaps"
+rm -rf "${ACTUAL_DIR}" "${HEATMAP_DIR}"
+mkdir -p "${ACTUAL_DIR}"
+
+# render_scene <name> <level> <seed> <tick> <palette> [bloom]
+# A fresh process per scene keeps render-side state (camera smoothing,
+# scrolling, exhaust) from leaking between scenes.
+render_scene() {
+    local name="$1" level="$2" seed="$3" tick="$4" palette="$5" bloom="${6:-}"
+    local work="${ACTUAL_DIR}/.${name}"
+    local flags=()
+    if [[ "${bloom}" == "bloom" ]]; then
+        flags+=(--bloom)
+    fi
+    mkdir -p "${work}"
+    "${BUILD_DIR}/sim_runner" --headless --resolution 1280x720 \
+        --seed "${seed}" --level "${level}" --palette "${palette}" \
+        --ticks "${tick}" --screenshots --screenshot-at-ticks "${tick}" \
+        --screenshot-output "${work}" ${flags[@]+"${flags[@]}"} \
+        --quiet > /dev/null || true
+    local image
+    image=$(find "${work}" -name '*.png' | head -n 1)
+    if [[ -z "${image}" ]]; then
+        echo "  ${name}: no image (did the bot die before tick ${tick}?)" >&2
+    else
+        mv "${image}" "${ACTUAL_DIR}/${name}.png"
+    fi
+    rm -rf "${work}"
+}
+export -f render_scene
+export BUILD_DIR ACTUAL_DIR
+
+echo "Rendering scenes from ${SCENES} (${JOBS} in parallel)..."
+grep -Ev '^[[:space:]]*(#|$)' "${SCENES}" |
+    xargs -P "${JOBS}" -L 1 bash -c 'render_scene "$@"' _
+
+if [[ ${UPDATE} -eq 1 ]]; then
+    mkdir -p "${GOLDEN_DIR}"
+    rm -f "${GOLDEN_DIR}"/*.png
+    cp "${ACTUAL_DIR}"/*.png "${GOLDEN_DIR}/"
+    echo "Updated goldens in ${GOLDEN_DIR}; review and commit them."
+    exit 0
+fi
+
+if [[ ! -d "${GOLDEN_DIR}" ]]; then
+    echo "No goldens in ${GOLDEN_DIR}; bless the current renders with --update" >&2
+    exit 2
+fi
+
+"${BUILD_DIR}/golden_diff" --heatmaps "${HEATMAP_DIR}" \
+    ${DIFF_FLAGS[@]+"${DIFF_FLAGS[@]}"} "${GOLDEN_DIR}" "${ACTUAL_DIR}"
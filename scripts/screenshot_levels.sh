@@ -8,6 +8,8 @@ BUILD_DIR="${1:-build}"
 OUTPUT_DIR="${SCREENSHOT_OUTPUT_DIR:-docs/screenshots-raw}"
 SEED="${SCREENSHOT_SEED:-0xC0FFEE}"
 INTERVAL="${SCREENSHOT_INTERVAL:-2400}"  # Screenshot every 20 seconds at 120Hz
+# Extra sim_runner flags, e.g. "--headless --resolution 1920x1080"
+read -r -a RENDER_FLAGS <<< "${SCREENSHOT_RENDER_FLAGS:-}"
 
 # Colors
 GREEN='\033[0;32m'
@@ -73,6 +75,7 @@ for level in $(seq 1 ${TOTAL_LEVELS}); do
             --screenshots \
             --screenshot-output "${LEVEL_DIR}" \
             --screenshot-interval "${INTERVAL}" \
+            ${RENDER_FLAGS[@]+"${RENDER_FLAGS[@]}"} \
             --ticks 12000 \
             --quiet || true  # Continue even if bot dies
         
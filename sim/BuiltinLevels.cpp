@@ -1,10 +1,38 @@
-#include "sim/Level.hpp"
+#include "sim/BuiltinLevels.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
 
-#include "core/Log.hpp"
+#include "sim/BuiltinLevelData.hpp" // Generated by levelc --emit-cpp
+#include "sim/Level.hpp"
+#include "sim/LevelPack.hpp"
 
 namespace {
 
-Level BuildPlaceholderLevel() {
+using namespace generated_levels;
+
+constexpr int kBuiltinLevelCount = 6;
+
+constexpr const char *kBuiltinLevelPaths[kBuiltinLevelCount] = {
+    "levels/stage1_level1.json", "levels/stage1_level2.json",
+    "levels/stage1_level3.json", "levels/stage2_level1.json",
+    "levels/stage2_level2.json", "levels/stage2_level3.json"};
+
+// A built-in level is its embedded data (compiled in from its JSON, can't
+// fail) unless its override is set. The override is the only other source:
+// seeded once from the level pack so mods ship without a rebuild, then set by
+// ReplaceBuiltinLevel when hot reload applies an edited JSON. JSON edits need
+// no path of their own; the build compiles them in and a running game gets
+// them through hot reload. Read by the main and level preload threads.
+std::atomic<const Level *> g_override[kBuiltinLevelCount] = {};
+std::once_flag g_overridesSeeded;
+
+// Main thread only. Storage for ReplaceBuiltinLevel, reused round robin.
+Level g_versions[kBuiltinLevelCount][kBuiltinLevelVersions];
+int g_nextVersion[kBuiltinLevelCount] = {};
+
+constexpr Level BuildPlaceholderLevel() {
   Level lv{};
   // Empty level - just a starting platform
   lv.segments[0].startZ = 0.0f;
@@ -18,73 +46,48 @@ Level BuildPlaceholderLevel() {
   return lv;
 }
 
-} // namespace
+constexpr Level kPlaceholderLevel = BuildPlaceholderLevel();
 
-const Level &GetLevel1() {
-  static Level lv = []() {
-    Level l{};
-    if (!LoadLevelFromFile(l, "levels/stage1_level1.json")) {
-      LOG_ERROR("Failed to load Level 1 from JSON, using empty level.");
-    }
-    return l;
-  }();
-  return lv;
+// The shipped levels are compiled in, variants and all, so they can't fail
+// to load. Checked here rather than on first use.
+constexpr bool IsPlayable(const Level &lv) {
+  return lv.segmentCount > 0 && lv.segments[0].variantIndex >= 0 &&
+         lv.totalLength > 0.0f;
 }
+static_assert(IsPlayable(kStage1Level1) && IsPlayable(kStage1Level2) &&
+                  IsPlayable(kStage1Level3) && IsPlayable(kStage2Level1) &&
+                  IsPlayable(kStage2Level2) && IsPlayable(kStage2Level3),
+              "Built-in level JSON failed to compile into a playable level");
 
-const Level &GetLevel2() {
-  static Level lv = []() {
-    Level l{};
-    if (!LoadLevelFromFile(l, "levels/stage1_level2.json")) {
-      LOG_ERROR("Failed to load Level 2 from JSON, using empty level.");
-    }
-    return l;
-  }();
-  return lv;
+void SeedOverrides() {
+  for (int i = 0; i < kBuiltinLevelCount; ++i) {
+    g_override[i].store(FindBuiltinPackedLevel(kBuiltinLevelPaths[i]),
+                        std::memory_order_relaxed);
+  }
 }
 
-const Level &GetLevel3() {
-  static Level lv = []() {
-    Level l{};
-    if (!LoadLevelFromFile(l, "levels/stage1_level3.json")) {
-      LOG_ERROR("Failed to load Level 3 from JSON, using empty level.");
-    }
-    return l;
-  }();
-  return lv;
+// Built-in level `levelIndex`: its override if it has one, else the data
+// compiled in from its JSON.
+const Level &Resolve(int levelIndex, const Level &embedded) {
+  std::call_once(g_overridesSeeded, SeedOverrides);
+  const Level *override =
+      g_override[levelIndex - 1].load(std::memory_order_acquire);
+  return override ? *override : embedded;
 }
 
-const Level &GetLevel4() {
-  static Level lv = []() {
-    Level l{};
-    if (!LoadLevelFromFile(l, "levels/stage2_level1.json")) {
-      LOG_ERROR("Failed to load Level 4 from JSON, using empty level.");
-    }
-    return l;
-  }();
-  return lv;
-}
+} // namespace
 
-const Level &GetLevel5() {
-  static Level lv = []() {
-    Level l{};
-    if (!LoadLevelFromFile(l, "levels/stage2_level2.json")) {
-      LOG_ERROR("Failed to load Level 5 from JSON, using empty level.");
-    }
-    return l;
-  }();
-  return lv;
-}
+const Level &GetLevel1() { return Resolve(1, kStage1Level1); }
 
-const Level &GetLevel6() {
-  static Level lv = []() {
-    Level l{};
-    if (!LoadLevelFromFile(l, "levels/stage2_level3.json")) {
-      LOG_ERROR("Failed to load Level 6 from JSON, using empty level.");
-    }
-    return l;
-  }();
-  return lv;
-}
+const Level &GetLevel2() { return Resolve(2, kStage1Level2); }
+
+const Level &GetLevel3() { return Resolve(3, kStage1Level3); }
+
+const Level &GetLevel4() { return Resolve(4, kStage2Level1); }
+
+const Level &GetLevel5() { return Resolve(5, kStage2Level2); }
+
+const Level &GetLevel6() { return Resolve(6, kStage2Level3); }
 
 const Level &GetLevelByIndex(int levelIndex) {
   if (levelIndex == 1)
@@ -100,6 +103,29 @@ const Level &GetLevelByIndex(int levelIndex) {
   if (levelIndex == 6)
     return GetLevel6();
 
-  static const Level placeholder = BuildPlaceholderLevel();
-  return placeholder;
+  return kPlaceholderLevel;
+}
+
+const char *GetBuiltinLevelPath(int levelIndex) {
+  if (levelIndex < 1 || levelIndex > kBuiltinLevelCount)
+    return nullptr;
+  return kBuiltinLevelPaths[levelIndex - 1];
+}
+
+int FindBuiltinLevelIndex(const char *relativePath) {
+  for (int i = 0; i < kBuiltinLevelCount; ++i) {
+    if (std::strcmp(kBuiltinLevelPaths[i], relativePath) == 0)
+      return i + 1;
+  }
+  return 0;
+}
+
+const Level &ReplaceBuiltinLevel(int levelIndex, const Level &level) {
+  std::call_once(g_overridesSeeded, SeedOverrides);
+  const int i = levelIndex - 1;
+  Level &latest = g_versions[i][g_nextVersion[i]];
+  g_nextVersion[i] = (g_nextVersion[i] + 1) % kBuiltinLevelVersions;
+  latest = level;
+  g_override[i].store(&latest, std::memory_order_release);
+  return latest;
 }
@@ -0,0 +1,26 @@
+#pragma once
+
+struct Level;
+
+// Built-in level lookup and replacement for level hot reload
+// (game/LevelHotReload). GetLevelByIndex and friends stay in sim/Level.hpp.
+
+// Versions of each built-in level ReplaceBuiltinLevel keeps valid. Reloads
+// are applied at most once per level per frame, and a preload build or a
+// stopped sim thread lets go of a level within a frame or two.
+constexpr int kBuiltinLevelVersions = 4;
+
+// Asset path of a built-in level ("levels/stage1_level1.json"), or null for
+// placeholder levels.
+const char *GetBuiltinLevelPath(int levelIndex);
+
+// Inverse of GetBuiltinLevelPath; 0 if `relativePath` isn't a built-in level.
+int FindBuiltinLevelIndex(const char *relativePath);
+
+// Main thread. Copy `level` into storage owned here and make it what
+// GetLevelByIndex(levelIndex) returns from now on. The storage is a ring of
+// kBuiltinLevelVersions per level, so a pointer to an earlier version stays
+// valid until that many more replacements of the same level; anything that
+// caches by address must be invalidated by the caller. `levelIndex` must
+// have a path.
+const Level &ReplaceBuiltinLevel(int levelIndex, const Level &level);
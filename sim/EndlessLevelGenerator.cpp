@@ -1,6 +1,8 @@
 #include "sim/EndlessLevelGenerator.hpp"
 #include "core/Rng.hpp"
 #include "core/Config.hpp"
+#include "core/PerfTracker.hpp"
+#include "sim/LevelVariantAssigner.hpp"
 #include "sim/PowerUp.hpp"
 #include <algorithm>
 #include <cmath>
@@ -16,15 +18,19 @@ namespace {
   constexpr float kSafeStartZone = 30.0f;  // Empty zone at start (no obstacles)
   constexpr float kMinObstacleSpacing = 3.0f;  // Minimum distance between obstacles
   constexpr float kMinPowerUpSpacing = 10.0f;  // Minimum distance between power-ups
+  // Level behind the player kept when making room; covers the drawn range
+  constexpr float kKeepBehindDistance = cfg::kLevelDrawDistance + kMaxSegmentLength;
 }
 
 void EndlessLevelGenerator::Initialize(uint32_t seed) {
+  perf::AllocScope allocScope(perf::AllocTag::Generator);
   rngState = (seed == 0) ? 1u : seed;
   currentZ = 0.0f;
   difficultyT = 0.0f;
   lastObstacleZ = -999.0f;  // Reset obstacle tracking
   lastPowerUpZ = -999.0f;  // Reset power-up tracking
   obstacleSurgePending = false;  // Reset obstacle surge
+  generatedSegments = 0;
   
   // Clear level
   level = Level{};
@@ -49,10 +55,12 @@ void EndlessLevelGenerator::Initialize(uint32_t seed) {
 }
 
 void EndlessLevelGenerator::ExtendLevel(float playerZ, float difficulty) {
+  perf::AllocScope allocScope(perf::AllocTag::Generator);
   difficultyT = difficulty;
   
   // Generate new chunks if player is getting close to the end
   while (currentZ < playerZ + kChunkGenerationDistance) {
+    DropBehind(playerZ - kKeepBehindDistance);
     GenerateChunk(currentZ, difficultyT);
   }
   
@@ -164,7 +172,7 @@ void EndlessLevelGenerator::GenerateChunk(float startZ, float difficulty) {
           // Check if position is safe (not blocked by obstacles)
           if (IsPowerUpPositionSafe(candidateZ, spawnX, currentZ, segmentLength, segmentWidth, xOffset)) {
             PowerUpType type = SelectPowerUpType(difficulty);
-            AddPowerUp(candidateZ, spawnX, spawnY, type);
+            AddPowerUp(candidateZ, spawnX, spawnY, topY, type);
             lastPowerUpZ = candidateZ;
           }
         }
@@ -178,12 +186,40 @@ void EndlessLevelGenerator::GenerateChunk(float startZ, float difficulty) {
   this->currentZ = currentZ;
 }
 
+void EndlessLevelGenerator::DropBehind(float z) {
+  // Everything is generated in Z order, so what ends before `z` is a prefix
+  int segs = 0;
+  while (segs < level.segmentCount &&
+         level.segments[segs].startZ + level.segments[segs].length < z) {
+    ++segs;
+  }
+  int obs = 0;
+  while (obs < level.obstacleCount && level.obstacles[obs].z < z) {
+    ++obs;
+  }
+  int pus = 0;
+  while (pus < level.powerUpCount && level.powerUps[pus].z < z) {
+    ++pus;
+  }
+
+  if (segs == 0 && obs == 0 && pus == 0) {
+    return;
+  }
+  std::copy(level.segments + segs, level.segments + level.segmentCount, level.segments);
+  std::copy(level.obstacles + obs, level.obstacles + level.obstacleCount, level.obstacles);
+  std::copy(level.powerUps + pus, level.powerUps + level.powerUpCount, level.powerUps);
+  level.segmentCount -= segs;
+  level.obstacleCount -= obs;
+  level.powerUpCount -= pus;
+}
+
 void EndlessLevelGenerator::AddSegment(float startZ, float length, float topY, float width, float xOffset) {
   if (level.segmentCount >= kMaxSegments) {
     return;  // Level is full
   }
   
   auto& seg = level.segments[level.segmentCount++];
+  ++generatedSegments;
   seg.startZ = startZ;
   seg.length = length;
   seg.topY = topY;
@@ -223,7 +259,7 @@ int EndlessLevelGenerator::NextInt(int min, int max) {
   return min + (int)(NextFloat01() * (max - min + 1));
 }
 
-void EndlessLevelGenerator::AddPowerUp(float z, float x, float y, PowerUpType type) {
+void EndlessLevelGenerator::AddPowerUp(float z, float x, float y, float groundY, PowerUpType type) {
   if (level.powerUpCount >= kMaxPowerUps) {
     return;  // Level is full
   }
@@ -232,6 +268,7 @@ void EndlessLevelGenerator::AddPowerUp(float z, float x, float y, PowerUpType ty
   pu.z = z;
   pu.x = x;
   pu.y = y;
+  pu.groundY = groundY;  // Spawned on this segment; renderers never search
   pu.type = type;
   pu.active = true;
   pu.bobOffset = NextFloat01() * 2.0f * 3.14159f;  // Random phase for animation
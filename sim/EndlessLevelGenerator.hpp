@@ -15,12 +15,15 @@ struct EndlessLevelGenerator {
   float lastObstacleZ = -999.0f;  // Track last obstacle Z for spacing
   float lastPowerUpZ = -999.0f;  // Track last power-up Z for spacing
   bool obstacleSurgePending = false;  // Obstacle surge debuff pending
+  int generatedSegments = 0;  // Since Initialize; over kMaxSegments once the window has moved
   
   // Generate initial level chunk
   void Initialize(uint32_t seed);
   
   // Extend the level as player progresses
-  // Should be called periodically to generate new chunks ahead of player
+  // Should be called periodically to generate new chunks ahead of player.
+  // The level is a window over the run: segments, obstacles and power-ups
+  // behind the drawn range are dropped to make room, shifting the rest down.
   void ExtendLevel(float playerZ, float difficulty);
   
   // Get the current level (for use in game)
@@ -30,9 +33,10 @@ struct EndlessLevelGenerator {
   
 private:
   void GenerateChunk(float startZ, float difficulty);
+  void DropBehind(float z);
   void AddSegment(float startZ, float length, float topY, float width, float xOffset);
   void AddObstacle(float z, float x, float y, float sizeX, float sizeY, float sizeZ, ObstacleShape shape);
-  void AddPowerUp(float z, float x, float y, PowerUpType type);
+  void AddPowerUp(float z, float x, float y, float groundY, PowerUpType type);
   PowerUpType SelectPowerUpType(float difficulty);
   bool IsPowerUpPositionSafe(float z, float x, float segmentStartZ, float segmentLength, float segmentWidth, float xOffset);
   float NextFloat01();
@@ -13,6 +13,8 @@ struct LevelSegment {
   int variantIndex = -1;     // -1 for auto, 0-7 for different visual styles
   float heightScale = -1.0f; // -1.0f for auto, otherwise visual multiplier
   int colorTint = -1;        // -1 for auto, 0-2 for color variation
+
+  bool operator==(const LevelSegment &) const = default;
 };
 
 // Obstacle shape variants
@@ -37,6 +39,8 @@ struct LevelObstacle {
   int colorIndex = -1; // -1 for auto, 0-2 for palette deco colors
   ObstacleShape shape = ObstacleShape::Unset;
   float rotation = -999.0f; // -999.0f for auto, otherwise deg around Y
+
+  bool operator==(const LevelObstacle &) const = default;
 };
 
 // Finish line style variants
@@ -70,6 +74,8 @@ struct FinishZone {
   float ringCount = 3.0f;     // For multi-ring style
   float glowIntensity = 1.0f; // Glow intensity multiplier
   bool hasRunway = true;      // Whether to draw runway markers
+
+  bool operator==(const FinishZone &) const = default;
 };
 
 // Start line zone data
@@ -86,6 +92,8 @@ struct StartZone {
   float glowIntensity = 1.0f; // Glow intensity multiplier
   int stripeCount = 5;        // Number of lane stripes
   float ringCount = 3.0f;     // For ringed launch style
+
+  bool operator==(const StartZone &) const = default;
 };
 
 // Fixed-capacity level data. No heap, fully constexpr-friendly.
@@ -105,6 +113,8 @@ struct Level {
                        // placeholders)
   StartZone
       start{}; // Start line zone (zero-initialized = no start for placeholders)
+
+  bool operator==(const Level &) const = default;
 };
 
 // Returns a pointer to the built-in level (static data, no alloc).
@@ -126,6 +136,11 @@ int GetLevelIndexFromStageAndLevel(int stage, int levelInStage); // Returns 1-30
 // Load level from a JSON file.
 bool LoadLevelFromFile(Level &level, const char *relativePath);
 
+// Same, with a path used as given rather than relative to assets/. Without
+// `assignVariants` auto (-1) variant fields are left as written.
+bool LoadLevelFromPath(Level &level, const char *path,
+                       bool assignVariants = true);
+
 // Check if a level index is implemented (currently 1-4 are implemented)
 bool IsLevelImplemented(int levelIndex);
 
@@ -145,11 +160,6 @@ bool CheckFinishZoneCrossing(const Level &level, float playerZ);
 // exists, otherwise default.
 float GetSpawnZ(const Level &level);
 
-// Assign deterministic visual variants to segments and obstacles based on their
-// properties. This ensures all players see the same visual variety
-// (deterministic, not random).
-void AssignVariants(Level &level);
-
 // Dynamic test to validate all levels in assets/levels are loadable.
 // Returns true if all files in the directory were successfully parsed.
 bool TestAllLevelsAccessibility();
@@ -2,6 +2,8 @@
 
 #include "core/Assets.hpp"
 #include "core/Log.hpp"
+#include "core/PerfTracker.hpp"
+#include "sim/LevelVariantAssigner.hpp"
 #include <filesystem>
 #include <fstream>
 #include <nlohmann/json.hpp>
@@ -85,12 +87,17 @@ ObstacleShape GetObstacleShape(const json &j, const char *key,
 } // namespace
 
 bool LoadLevelFromFile(Level &level, const char *relativePath) {
+  return LoadLevelFromPath(level, assets::Path(relativePath));
+}
+
+bool LoadLevelFromPath(Level &level, const char *path,
+                       bool assignVariants) {
+  perf::AllocScope allocScope(perf::AllocTag::JsonLoad);
   level = {}; // Reset
 
-  std::string fullPath = assets::Path(relativePath);
-  std::ifstream f(fullPath);
+  std::ifstream f(path);
   if (!f.is_open()) {
-    LOG_ERROR("Failed to open level file: {}", fullPath);
+    LOG_ERROR("Failed to open level file: {}", path);
     return false;
   }
 
@@ -164,10 +171,11 @@ bool LoadLevelFromFile(Level &level, const char *relativePath) {
       level.finish.hasRunway = fz.value("hasRunway", true);
     }
 
-    AssignVariants(level);
+    if (assignVariants)
+      AssignVariants(level);
     return true;
   } catch (const json::parse_error &e) {
-    LOG_ERROR("JSON parse error in {}: {}", relativePath, e.what());
+    LOG_ERROR("JSON parse error in {}: {}", path, e.what());
     return false;
   }
 }
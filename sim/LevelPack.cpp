@@ -0,0 +1,244 @@
+#include "sim/LevelPack.hpp"
+
+#include "core/Assets.hpp"
+#include "core/Log.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+static_assert(std::is_trivially_copyable_v<Level>,
+              "Level is stored in level packs byte for byte");
+
+namespace {
+
+constexpr char kMagic[4] = {'S', 'R', 'L', 'P'};
+
+constexpr uint32_t kFnvOffset = 2166136261u;
+constexpr uint32_t kFnvPrime = 16777619u;
+
+uint32_t HashValue(uint32_t hash, uint64_t value) {
+  for (int i = 0; i < 8; ++i) {
+    hash ^= static_cast<uint32_t>((value >> (i * 8)) & 0xFFu);
+    hash *= kFnvPrime;
+  }
+  return hash;
+}
+
+size_t AlignUp(size_t value) {
+  return (value + kLevelPackAlignment - 1) & ~(kLevelPackAlignment - 1);
+}
+
+// StoreLevel copies the padded structs field by field; a new field has to be
+// added there too.
+static_assert(sizeof(LevelSegment) == 8 * 4 && sizeof(LevelObstacle) == 9 * 4 &&
+                  sizeof(StartZone) == 11 * 4,
+              "StoreLevel copies these whole, so they must have no padding");
+static_assert(sizeof(PowerUp) == 8 * 4 && sizeof(FinishZone) == 9 * 4,
+              "Update StoreLevel for the new PowerUp or FinishZone field");
+
+// Copies `level` into zero-filled `out` member by member, so the padding
+// after PowerUp::active and FinishZone::hasRunway stays zero and identical
+// levels give byte-identical packs.
+void StoreLevel(unsigned char *out, const Level &level) {
+  Level &dst = *reinterpret_cast<Level *>(out);
+  std::copy(level.segments, level.segments + kMaxSegments, dst.segments);
+  dst.segmentCount = level.segmentCount;
+  std::copy(level.obstacles, level.obstacles + kMaxObstacles, dst.obstacles);
+  dst.obstacleCount = level.obstacleCount;
+  for (int i = 0; i < kMaxPowerUps; ++i) {
+    const PowerUp &src = level.powerUps[i];
+    PowerUp &p = dst.powerUps[i];
+    p.z = src.z;
+    p.x = src.x;
+    p.y = src.y;
+    p.groundY = src.groundY;
+    p.type = src.type;
+    p.active = src.active;
+    p.bobOffset = src.bobOffset;
+    p.rotation = src.rotation;
+  }
+  dst.powerUpCount = level.powerUpCount;
+  dst.totalLength = level.totalLength;
+  dst.finish.startZ = level.finish.startZ;
+  dst.finish.endZ = level.finish.endZ;
+  dst.finish.style = level.finish.style;
+  dst.finish.width = level.finish.width;
+  dst.finish.xOffset = level.finish.xOffset;
+  dst.finish.topY = level.finish.topY;
+  dst.finish.ringCount = level.finish.ringCount;
+  dst.finish.glowIntensity = level.finish.glowIntensity;
+  dst.finish.hasRunway = level.finish.hasRunway;
+  dst.start = level.start;
+}
+
+} // namespace
+
+uint32_t LevelPackLayoutHash() {
+  const uint64_t layout[] = {
+      sizeof(Level),
+      offsetof(Level, segmentCount),
+      offsetof(Level, obstacles),
+      offsetof(Level, obstacleCount),
+      offsetof(Level, powerUps),
+      offsetof(Level, powerUpCount),
+      offsetof(Level, totalLength),
+      offsetof(Level, finish),
+      offsetof(Level, start),
+      sizeof(LevelSegment),
+      offsetof(LevelSegment, colorTint),
+      sizeof(LevelObstacle),
+      offsetof(LevelObstacle, rotation),
+      sizeof(PowerUp),
+      offsetof(PowerUp, rotation),
+      sizeof(FinishZone),
+      offsetof(FinishZone, hasRunway),
+      sizeof(StartZone),
+      offsetof(StartZone, ringCount),
+  };
+  uint32_t hash = kFnvOffset;
+  for (uint64_t value : layout)
+    hash = HashValue(hash, value);
+  return hash;
+}
+
+uint32_t LevelPackChecksum(const unsigned char *data, size_t size) {
+  uint32_t hash = kFnvOffset;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= data[i];
+    hash *= kFnvPrime;
+  }
+  return hash;
+}
+
+bool WriteLevelPack(const char *path, const char *const *names,
+                    const Level *levels, int count) {
+  const size_t tableEnd =
+      sizeof(LevelPackHeader) + sizeof(LevelPackEntry) * count;
+  const size_t levelStride = AlignUp(sizeof(Level));
+  std::vector<unsigned char> bytes(AlignUp(tableEnd) + levelStride * count);
+
+  auto *entries = reinterpret_cast<LevelPackEntry *>(bytes.data() +
+                                                     sizeof(LevelPackHeader));
+  for (int i = 0; i < count; ++i) {
+    if (std::strlen(names[i]) >= sizeof(entries[i].name)) {
+      LOG_ERROR("Level pack name too long: {}", names[i]);
+      return false;
+    }
+    std::strncpy(entries[i].name, names[i], sizeof(entries[i].name));
+    entries[i].offset = AlignUp(tableEnd) + levelStride * i;
+    StoreLevel(bytes.data() + entries[i].offset, levels[i]);
+  }
+
+  LevelPackHeader header = {};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kLevelPackVersion;
+  header.layoutHash = LevelPackLayoutHash();
+  header.levelCount = static_cast<uint32_t>(count);
+  header.checksum =
+      LevelPackChecksum(bytes.data() + sizeof(LevelPackHeader),
+                        bytes.size() - sizeof(LevelPackHeader));
+  std::memcpy(bytes.data(), &header, sizeof(header));
+
+  std::FILE *f = std::fopen(path, "wb");
+  if (!f) {
+    LOG_ERROR("Failed to open level pack for writing: {}", path);
+    return false;
+  }
+  const bool ok = std::fwrite(bytes.data(), 1, bytes.size(), f) ==
+                  bytes.size();
+  return std::fclose(f) == 0 && ok;
+}
+
+bool OpenLevelPack(LevelPack &pack, const char *path) {
+  pack = {};
+  core::MappedFile file;
+  if (!core::MapFile(path, file))
+    return false;
+
+  const char *error = nullptr;
+  const auto *header = reinterpret_cast<const LevelPackHeader *>(file.data);
+  if (file.size < sizeof(LevelPackHeader) ||
+      std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0) {
+    error = "not a level pack";
+  } else if (header->version != kLevelPackVersion) {
+    error = "format version mismatch";
+  } else if (header->layoutHash != LevelPackLayoutHash()) {
+    error = "Level layout mismatch";
+  } else if (file.size < sizeof(LevelPackHeader) +
+                             sizeof(LevelPackEntry) * header->levelCount) {
+    error = "truncated";
+  } else if (header->checksum !=
+             LevelPackChecksum(file.data + sizeof(LevelPackHeader),
+                               file.size - sizeof(LevelPackHeader))) {
+    error = "checksum mismatch";
+  }
+
+  const auto *entries = reinterpret_cast<const LevelPackEntry *>(
+      file.data + sizeof(LevelPackHeader));
+  for (uint32_t i = 0; !error && i < header->levelCount; ++i) {
+    const LevelPackEntry &entry = entries[i];
+    if (entry.offset % kLevelPackAlignment != 0 ||
+        entry.offset > file.size || file.size - entry.offset < sizeof(Level) ||
+        std::memchr(entry.name, '\0', sizeof(entry.name)) == nullptr)
+      error = "bad entry";
+  }
+
+  if (error) {
+    LOG_WARN("Ignoring level pack {}: {}", path, error);
+    core::UnmapFile(file);
+    return false;
+  }
+  pack.file = file;
+  pack.header = header;
+  pack.entries = entries;
+  return true;
+}
+
+void CloseLevelPack(LevelPack &pack) {
+  core::UnmapFile(pack.file);
+  pack = {};
+}
+
+const Level *FindPackedLevel(const LevelPack &pack, const char *name) {
+  if (!pack.header)
+    return nullptr;
+  for (uint32_t i = 0; i < pack.header->levelCount; ++i) {
+    if (std::strcmp(pack.entries[i].name, name) == 0) {
+      return reinterpret_cast<const Level *>(pack.file.data +
+                                             pack.entries[i].offset);
+    }
+  }
+  return nullptr;
+}
+
+const Level *FindBuiltinPackedLevel(const char *relativePath) {
+  namespace fs = std::filesystem;
+  static const std::string packPath = assets::Path(kBuiltinLevelPack);
+  static LevelPack pack = []() {
+    LevelPack p;
+    if (OpenLevelPack(p, packPath.c_str()))
+      LOG_INFO("Level pack: {} levels from {}", p.header->levelCount,
+               packPath);
+    return p;
+  }();
+
+  const Level *level = FindPackedLevel(pack, relativePath);
+  if (!level)
+    return nullptr;
+  std::error_code packError;
+  std::error_code jsonError;
+  const auto packTime = fs::last_write_time(packPath, packError);
+  const auto jsonTime =
+      fs::last_write_time(assets::Path(relativePath), jsonError);
+  if (!packError && !jsonError && jsonTime > packTime) {
+    LOG_INFO("{} is newer than the level pack, ignoring its entry",
+             relativePath);
+    return nullptr;
+  }
+  return level;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "core/MappedFile.hpp"
+#include "sim/Level.hpp"
+
+// Compiled level pack: level JSON parsed, variant-assigned and stored as raw
+// Level structs, written by tools/levelc.
+//
+// File layout (little-endian, native struct layout):
+//   LevelPackHeader
+//   LevelPackEntry[levelCount]   names and offsets
+//   Level blobs, each at a kLevelPackAlignment-aligned offset
+//
+// The header carries a format version, a hash of the Level struct layout and
+// a checksum of everything after the header. A pack written by a different
+// format version or struct layout, or a corrupt one, is rejected as a whole
+// and the game keeps its embedded levels. Opening maps the file and
+// validates it once; levels are then used in place, without copying.
+
+constexpr uint32_t kLevelPackVersion = 1;
+constexpr size_t kLevelPackAlignment = 16;
+constexpr int kLevelPackNameSize = 56;
+
+// Optional; built with `levelc assets/levels/*.json` to ship modified levels
+// without rebuilding the game.
+constexpr const char *kBuiltinLevelPack = "levels/levels.pack";
+
+struct LevelPackHeader {
+  char magic[4]; // "SRLP"
+  uint32_t version;
+  uint32_t layoutHash; // LevelPackLayoutHash() of the writer
+  uint32_t levelCount;
+  uint32_t checksum; // FNV-1a over the bytes after the header
+  uint32_t reserved;
+};
+
+struct LevelPackEntry {
+  char name[kLevelPackNameSize]; // Asset path, e.g. "levels/stage1_level1.json"
+  uint64_t offset;               // Of the Level, from the start of the file
+};
+
+// Changes whenever the size or member offsets of Level and its parts change.
+uint32_t LevelPackLayoutHash();
+
+uint32_t LevelPackChecksum(const unsigned char *data, size_t size);
+
+// Writes `count` levels under the given names. False on I/O errors or names
+// too long for an entry.
+bool WriteLevelPack(const char *path, const char *const *names,
+                    const Level *levels, int count);
+
+struct LevelPack {
+  core::MappedFile file;
+  const LevelPackHeader *header = nullptr;
+  const LevelPackEntry *entries = nullptr;
+};
+
+// Maps and validates a pack. On failure logs why and leaves `pack` closed.
+bool OpenLevelPack(LevelPack &pack, const char *path);
+void CloseLevelPack(LevelPack &pack);
+
+// The level stored under `name`, pointing into the mapping, or null.
+const Level *FindPackedLevel(const LevelPack &pack, const char *name);
+
+// Looks `relativePath` up in the built-in pack, opened on first use and kept
+// for the life of the process. Null when there is no valid pack, the level
+// isn't in it, or its JSON is newer than the pack: the build compiles that
+// JSON in, so a stale pack must not shadow it.
+const Level *FindBuiltinPackedLevel(const char *relativePath);
@@ -1,20 +1,38 @@
-#include "sim/Level.hpp"
+#pragma once
 
 #include <cstdint>
 
-namespace {
+#include "sim/Level.hpp"
+
+// Header-only so built-in levels can run it at compile time (see
+// sim/BuiltinLevels.cpp).
+
+namespace level_variants {
+
+// Float to hash bits, through int64 so negative coordinates wrap the way
+// they always have on x86-64. A direct cast of a negative float to uint32 is
+// undefined, and rejected in constant evaluation.
+constexpr uint32_t HashBits(float value) {
+  return static_cast<uint32_t>(static_cast<int64_t>(value));
+}
+
+} // namespace level_variants
+
+// Assign deterministic visual variants to segments and obstacles based on their
+// properties. This ensures all players see the same visual variety
+// (deterministic, not random).
+constexpr void AssignVariants(Level &lv) {
+  using level_variants::HashBits;
 
-void AssignVariantsHelper(Level &lv) {
   // Assign segment variants
   for (int i = 0; i < lv.segmentCount; ++i) {
     auto &seg = lv.segments[i];
 
     // Create deterministic hash from segment properties
     // Using integer conversion to ensure consistent hashing
-    uint32_t hash = static_cast<uint32_t>(seg.startZ * 10.0f) ^
-                    static_cast<uint32_t>(seg.width * 100.0f) ^
-                    static_cast<uint32_t>(seg.topY * 50.0f) ^
-                    static_cast<uint32_t>(seg.length * 5.0f) ^
+    uint32_t hash = HashBits(seg.startZ * 10.0f) ^
+                    HashBits(seg.width * 100.0f) ^ HashBits(seg.topY * 50.0f) ^
+                    HashBits(seg.length * 5.0f) ^
                     static_cast<uint32_t>(i * 17u);
 
     // Variant selection: 0=Standard, 1=Thin, 2=Thick, 3=Wide, 4=Narrow,
@@ -48,10 +66,8 @@ void AssignVariantsHelper(Level &lv) {
     auto &obs = lv.obstacles[i];
 
     // Create deterministic hash from obstacle properties
-    uint32_t hash = static_cast<uint32_t>(obs.z * 10.0f) ^
-                    static_cast<uint32_t>(obs.x * 100.0f) ^
-                    static_cast<uint32_t>(obs.y * 50.0f) ^
-                    static_cast<uint32_t>(obs.sizeY * 30.0f) ^
+    uint32_t hash = HashBits(obs.z * 10.0f) ^ HashBits(obs.x * 100.0f) ^
+                    HashBits(obs.y * 50.0f) ^ HashBits(obs.sizeY * 30.0f) ^
                     static_cast<uint32_t>(i * 23u);
 
     // Shape selection based on size and position
@@ -78,7 +94,3 @@ void AssignVariantsHelper(Level &lv) {
     }
   }
 }
-
-} // namespace
-
-void AssignVariants(Level &level) { AssignVariantsHelper(level); }
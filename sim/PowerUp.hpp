@@ -19,10 +19,13 @@ struct PowerUp {
   float z = 0.0f;
   float x = 0.0f;
   float y = 0.0f;      // Height above segment
+  float groundY = 0.0f;  // Top of the segment it sits on, resolved at spawn
   PowerUpType type = PowerUpType::None;
   bool active = true;
   float bobOffset = 0.0f;  // For floating animation
   float rotation = 0.0f;   // For rotation animation
+
+  bool operator==(const PowerUp &) const = default;
 };
 
 // Active effect on the player
@@ -7,6 +7,7 @@
 #include "core/Rng.hpp"
 #include "game/Game.hpp"
 #include "sim/Level.hpp"
+#include "sim/LevelVariantAssigner.hpp"
 #include "sim/PowerUp.hpp"
 
 namespace {
@@ -37,52 +38,48 @@ float Clamp(const float value, const float minValue, const float maxValue) {
   return value;
 }
 
-float Clamp01(const float value) { return Clamp(value, 0.0f, 1.0f); }
-
-void UpdateLandingParticles(Game &game, const float dt) {
-  for (auto &p : game.landingParticles) {
-    if (!p.active) {
-      continue;
-    }
-    p.life = ClampMinZero(p.life - dt);
-    if (p.life <= 0.0f) {
-      p.active = false;
-      continue;
-    }
-
-    const float dragT = Clamp01(cfg::kLandingParticleDrag * dt);
-    p.velocity.x *= (1.0f - dragT);
-    p.velocity.z *= (1.0f - dragT);
-    p.velocity.y += cfg::kGravity * 0.35f * dt;
-    p.position.x += p.velocity.x * dt;
-    p.position.y += p.velocity.y * dt;
-    p.position.z += p.velocity.z * dt;
-  }
-}
-
-void SpawnLandingBurst(Game &game, const Vector3 &origin) {
-  int spawned = 0;
-  for (auto &p : game.landingParticles) {
-    if (p.active) {
-      continue;
+// Burst particles fall under part of the ship's gravity and slow down
+// sideways only.
+constexpr core::ParticleMotion kBurstMotion = {
+    {cfg::kLandingParticleDrag, 0.0f, cfg::kLandingParticleDrag},
+    cfg::kGravity * 0.35f};
+
+// A ring of sparks thrown outwards and up from a point.
+struct BurstEmitter {
+  int count;
+  float speedMin;
+  float speedMax;
+  float riseSpeed;
+  float life;
+};
+
+constexpr BurstEmitter kLandingBurst = {
+    cfg::kLandingBurstCount, cfg::kLandingParticleSpeedMin,
+    cfg::kLandingParticleSpeedMax, cfg::kLandingParticleRiseSpeed,
+    cfg::kLandingParticleLife};
+
+// Pickups share the landing look for now.
+constexpr BurstEmitter kPickupBurst = kLandingBurst;
+
+void EmitBurst(Game &game, const BurstEmitter &emitter,
+               const Vector3 &origin) {
+  for (int i = 0; i < emitter.count; ++i) {
+    // Check before drawing: a full pool must not advance the sim RNG.
+    if (game.particles.Full()) {
+      game.particles.dropped += static_cast<uint32_t>(emitter.count - i);
+      break;
     }
     const float angle = core::NextFloat01(game.rngState) * 2.0f * PI;
     const float speed =
-        cfg::kLandingParticleSpeedMin +
-        (cfg::kLandingParticleSpeedMax - cfg::kLandingParticleSpeedMin) *
-            core::NextFloat01(game.rngState);
-    p.active = true;
-    p.position = origin;
-    p.velocity = Vector3{std::cos(angle) * speed,
-                         cfg::kLandingParticleRiseSpeed *
-                             (0.7f + 0.6f * core::NextFloat01(game.rngState)),
-                         std::sin(angle) * speed};
-    p.life = cfg::kLandingParticleLife *
-             (0.75f + 0.5f * core::NextFloat01(game.rngState));
-    ++spawned;
-    if (spawned >= cfg::kLandingBurstCount) {
-      break;
-    }
+        emitter.speedMin + (emitter.speedMax - emitter.speedMin) *
+                               core::NextFloat01(game.rngState);
+    const Vector3 velocity = {
+        std::cos(angle) * speed,
+        emitter.riseSpeed * (0.7f + 0.6f * core::NextFloat01(game.rngState)),
+        std::sin(angle) * speed};
+    const float life =
+        emitter.life * (0.75f + 0.5f * core::NextFloat01(game.rngState));
+    game.particles.Spawn(origin, velocity, life);
   }
 }
 
@@ -237,7 +234,7 @@ void UpdateActiveEffects(Game &game, const float dt) {
 } // namespace
 
 void SimStep(Game &game, const float dt) {
-  UpdateLandingParticles(game, dt);
+  game.particles.Update(kBurstMotion, dt);
 
   if (!game.runActive) {
     game.input.jumpQueued = false;
@@ -362,8 +359,7 @@ void SimStep(Game &game, const float dt) {
         if (CheckPowerUpCollision(player.position, pu)) {
           ActivatePowerUp(game, pu.type);
           pu.active = false;  // Consume power-up
-          // Spawn pickup particles (reuse landing particles)
-          SpawnLandingBurst(game, Vector3{pu.x, pu.y, pu.z});
+          EmitBurst(game, kPickupBurst, Vector3{pu.x, pu.y, pu.z});
         }
       }
     } else {
@@ -433,8 +429,9 @@ void SimStep(Game &game, const float dt) {
         player.grounded = true;
         player.coyoteTimer = cfg::kCoyoteTime;
         if (!wasGrounded) {
-          SpawnLandingBurst(game, Vector3{player.position.x, seg.topY + 0.02f,
-                                          player.position.z});
+          EmitBurst(game, kLandingBurst,
+                    Vector3{player.position.x, seg.topY + 0.02f,
+                            player.position.z});
         }
       } else {
         player.grounded = false;
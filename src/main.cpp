@@ -1,17 +1,69 @@
 #include <chrono>
 #include <cstdio>
 #include <ctime>
+#include <string>
+#include <utility>
 
 #include <raylib.h>
 
 #include "core/Config.hpp"
+#include "core/FrameStats.hpp"
 #include "core/CrashHandler.hpp"
 #include "core/Log.hpp"
 #include "core/PerfTracker.hpp"
 #include "game/Game.hpp"
+#include "game/LevelHotReload.hpp"
+#include "game/SimThread.hpp"
+#include "render/DrawStats.hpp"
+#include "render/FrameRecorder.hpp"
 #include "render/Render.hpp"
+#include "render/ScreenshotQueue.hpp"
 #include "sim/Sim.hpp"
 
+namespace {
+
+// "<prefix>_YYYYMMDD_HHMMSS<ext>" in local time.
+void FormatTimestampedName(char *out, size_t size, const char *prefix,
+                           const char *ext) {
+  std::time_t now = std::time(nullptr);
+  std::tm *tm = std::localtime(&now);
+  std::snprintf(out, size, "%s_%04d%02d%02d_%02d%02d%02d%s", prefix,
+                tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday, tm->tm_hour,
+                tm->tm_min, tm->tm_sec, ext);
+}
+
+// F11: start streaming every rendered frame to a Y4M file, or finish the
+// running recording.
+void ToggleRecording(Game &game) {
+  static char recordPath[256];
+  if (render::IsRecording()) {
+    render::StopRecording();
+    const render::RecorderStats stats = render::GetRecorderStats();
+    LOG_INFO("Recording saved: {} ({} frames, {} dropped)", recordPath,
+             stats.framesWritten, stats.framesDropped);
+    game.screenshotNotificationTitle = "Recording saved!";
+    std::snprintf(game.screenshotPath, sizeof(game.screenshotPath), "%s",
+                  recordPath);
+    game.screenshotNotificationTimer = 3.0f;
+    return;
+  }
+
+  char stem[224];
+  FormatTimestampedName(stem, sizeof(stem), "recording", "");
+  std::snprintf(recordPath, sizeof(recordPath), "%s.y4m", stem);
+  render::RecorderConfig config;
+  config.path = recordPath;
+  config.timestampPath = std::string(stem) + ".csv";
+  config.fps = game.framePacer.targetFps > 0 ? game.framePacer.targetFps : 60;
+  if (render::StartRecording(config)) {
+    LOG_INFO("Recording to {}", recordPath);
+  } else {
+    LOG_WARN("Could not start recording to {}", recordPath);
+  }
+}
+
+} // namespace
+
 int main() {
   Log::Init();
   CrashHandler::Init();
@@ -21,19 +73,48 @@ int main() {
   InitWindow(cfg::kScreenWidth, cfg::kScreenHeight, "SkyRoads Runner");
   SetExitKey(
       0); // Disable raylib's default ESC=quit so we handle ESC ourselves.
-  SetTargetFPS(0);
+  SetTargetFPS(0); // Pacing is done by core::FramePacer below.
 
   Game game{};
   InitGame(game, 0xC0FFEEu);
+  ApplyFrameRatePreset(game);
   InitRenderer();
+  StartLevelHotReload();
 
   using Clock = std::chrono::steady_clock;
+  static SimThread simThread; // Large; keep it off the stack
+  bool lastFramePlaying = false;
 
   while (!WindowShouldClose() && !game.wantsExit) {
+    const bool startedPlaying = game.screen == GameScreen::Playing;
+
+    // Take sim state back before anything on this thread edits it. With
+    // the run over, ReadInput submits its score from the final state.
+    if (IsSimThreadRunning(simThread) &&
+        (!game.simThreadEnabled || game.screen != GameScreen::Playing ||
+         game.runOver || LevelReloadPending())) {
+      StopSimThread(simThread, game);
+    }
+
+    // While the sim thread runs, ReadInput only sets input and may leave
+    // Playing (pause); both are this thread's state.
     ReadInput(game);
+    if (IsSimThreadRunning(simThread) &&
+        (game.screen != GameScreen::Playing || game.input.restartSameQueued ||
+         game.input.restartNewQueued)) {
+      StopSimThread(simThread, game);
+    }
+
+    // Edited level JSON lands between ticks. A save that arrived after the
+    // check above waits for the next frame.
+    if (!IsSimThreadRunning(simThread)) {
+      ApplyLevelReloads(game);
+    }
+
     ApplyMetaActions(game);
 
     float frameTime = GetFrameTime();
+    const float rawFrameMs = frameTime * 1000.0f;
     if (frameTime > cfg::kMaxFrameTime) {
       frameTime = cfg::kMaxFrameTime;
     }
@@ -41,14 +122,26 @@ int main() {
     // --- Measure Update (sim steps) --- only when Playing ---
     perf::ResetAllocCounter();
     const auto updateStart = Clock::now();
-
-    if (game.screen == GameScreen::Playing) {
+    int simSteps = 0;
+    bool simClamped = false;
+    float alpha = 0.0f;
+    const bool threadedSim =
+        game.screen == GameScreen::Playing && game.simThreadEnabled;
+
+    if (threadedSim) {
+      // Sim runs on its own thread: forward input and take the newest
+      // snapshot. updateMs then reports the sim thread's last batch.
+      if (!IsSimThreadRunning(simThread)) {
+        StartSimThread(simThread, game);
+      }
+      PushSimInput(simThread, game.input);
+      alpha = SyncFromSimThread(simThread, game, simSteps, simClamped);
+    } else if (game.screen == GameScreen::Playing) {
+      perf::AllocScope allocScope(perf::AllocTag::Sim);
       game.accumulator += frameTime;
-      int simSteps = 0;
-      constexpr int kMaxSimStepsPerFrame = 8;
 
       while (game.accumulator >= cfg::kFixedDt &&
-             simSteps < kMaxSimStepsPerFrame) {
+             simSteps < cfg::kMaxSimStepsPerFrame) {
         game.previousPlayer = game.player;
         if (game.runActive) {
           SimStep(game, cfg::kFixedDt);
@@ -58,15 +151,19 @@ int main() {
         ++simSteps;
       }
 
-      if (simSteps == kMaxSimStepsPerFrame) {
+      if (simSteps == cfg::kMaxSimStepsPerFrame) {
         game.accumulator = 0.0f;
+        simClamped = true;
       }
+      alpha = game.accumulator / cfg::kFixedDt;
     }
 
     const auto updateEnd = Clock::now();
-    game.updateMs =
-        std::chrono::duration<float, std::milli>(updateEnd - updateStart)
-            .count();
+    if (!threadedSim) {
+      game.updateMs =
+          std::chrono::duration<float, std::milli>(updateEnd - updateStart)
+              .count();
+    }
     game.updateAllocCount = perf::ReadAllocCounter();
 
 #ifndef NDEBUG
@@ -79,11 +176,14 @@ int main() {
 #endif
 
     // --- Measure Render ---
-    const float alpha = (game.screen == GameScreen::Playing)
-                            ? game.accumulator / cfg::kFixedDt
-                            : 0.0f;
     const auto renderStart = Clock::now();
-    RenderFrame(game, alpha, frameTime);
+    {
+      perf::AllocScope allocScope(perf::AllocTag::Render);
+      // Pass boundaries only flush for measurement while F4 is up.
+      render::SetDrawStatsEnabled(game.perfOverlayVisible &&
+                                  render::DrawStatsAvailable());
+      RenderFrame(game, alpha, frameTime);
+    }
     const auto renderEnd = Clock::now();
     game.renderMs =
         std::chrono::duration<float, std::milli>(renderEnd - renderStart)
@@ -91,22 +191,53 @@ int main() {
 
     // --- Take screenshot if requested (after rendering) ---
     if (game.screenshotRequested) {
-      std::time_t now = std::time(nullptr);
-      std::tm *tm = std::localtime(&now);
       char filename[256];
-      std::snprintf(filename, sizeof(filename),
-                    "screenshot_%04d%02d%02d_%02d%02d%02d.png",
-                    tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday,
-                    tm->tm_hour, tm->tm_min, tm->tm_sec);
-      TakeScreenshot(filename);
+      FormatTimestampedName(filename, sizeof(filename), "screenshot", ".png");
+      // Only the readback happens here; encoding and the write run on
+      // the screenshot worker.
+      render::ScreenshotRequest request;
+      request.path = filename;
+      render::CaptureScreenshot(std::move(request));
+      game.screenshotNotificationTitle = "Screenshot saved!";
       std::snprintf(game.screenshotPath, sizeof(game.screenshotPath), "%s",
                     filename);
       game.screenshotNotificationTimer =
           3.0f; // Show notification for 3 seconds
       game.screenshotRequested = false;
     }
+
+    // --- Stream the frame to the running recording (F11) ---
+    if (game.recordingToggleRequested) {
+      game.recordingToggleRequested = false;
+      ToggleRecording(game);
+    }
+    if (render::IsRecording()) {
+      render::RecordFrame(game.simTicks);
+    }
+
+    // --- Pace to the target frame rate ---
+    core::WaitForNextFrame(game.framePacer);
+
+    perf::FrameSample sample;
+    sample.frameMs = rawFrameMs;
+    sample.simMs = game.updateMs;
+    sample.renderMs = game.renderMs;
+    sample.simSteps = simSteps;
+    sample.simClamped = simClamped;
+    sample.pacerJitterMs = game.framePacer.lastJitterMs;
+    // The history describes gameplay only: skip menu and pause frames, and
+    // the first frame back in a run, whose frame time still covers the
+    // previous screen or the level load.
+    const bool framePlaying =
+        startedPlaying && game.screen == GameScreen::Playing;
+    if (framePlaying && lastFramePlaying) {
+      perf::PushFrameSample(game.frameHistory, sample);
+    }
+    lastFramePlaying = framePlaying;
   }
 
+  StopSimThread(simThread, game);
+  StopLevelHotReload();
   LOG_INFO("SkyRoads shutting down...");
   CleanupRenderer();
   CloseWindow();
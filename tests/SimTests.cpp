@@ -1,12 +1,41 @@
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
+#include <cstdio>
 #include <cstring>
+#include <filesystem>
 #include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "core/Config.hpp"
+#include "core/FramePacer.hpp"
+#include "core/FileWatcher.hpp"
+#include "core/FrameStats.hpp"
+#include "core/ImageDiff.hpp"
 #include "core/Log.hpp"
+#include "core/ParticleSystem.hpp"
+#include "core/PerfTracker.hpp"
+#include "core/TripleBuffer.hpp"
 #include "game/Game.hpp"
+#include "game/SimThread.hpp"
+#include "render/DrawStats.hpp"
+#include "render/FrameRecorder.hpp"
+#include "render/Frustum.hpp"
+#include "render/LevelMesh.hpp"
+#include "render/LevelPreload.hpp"
+#include "render/Lod.hpp"
+#include "render/Palette.hpp"
+#include "render/Prefab.hpp"
+#include "render/ScreenshotQueue.hpp"
+#include "sim/BuiltinLevels.hpp"
+#include "sim/EndlessLevelGenerator.hpp"
 #include "sim/Level.hpp"
+#include "sim/LevelPack.hpp"
+#include "sim/LevelVariantAssigner.hpp"
 #include "sim/Sim.hpp"
 
 namespace {
@@ -739,6 +768,749 @@ bool TestStartZonePlaceholderLevel() {
   return true;
 }
 
+bool TestEndlessSimStepZeroAllocations() {
+  Game game{};
+  ResetRun(game, 0xA110Cu, 0); // Endless Mode
+  if (!game.isEndlessMode)
+    return false;
+
+  perf::ResetAllocStats();
+  perf::ResetAllocCounter();
+
+  const float startZ = game.player.position.z;
+  for (int i = 0; i < 100000; ++i) {
+    game.input.moveX = ((i / 240) % 2 == 0) ? 1.0f : -1.0f;
+    game.input.jumpQueued = (i % 90) == 0;
+    SimStep(game, cfg::kFixedDt);
+
+    // Revive in place so the generator keeps extending the level.
+    if (game.runOver) {
+      game.runOver = false;
+      game.runActive = true;
+      game.player.position.y = 5.0f;
+      game.player.velocity.y = 0.0f;
+    }
+  }
+
+  // Make sure the run actually exercised level generation, well past the
+  // point where the level window is full and starts dropping segments.
+  const EndlessLevelGenerator &gen = game.endlessGenerator;
+  if (game.player.position.z - startZ < 1000.0f ||
+      gen.generatedSegments < 2 * kMaxSegments ||
+      gen.GetLevel().segmentCount > kMaxSegments ||
+      gen.GetLevel().segments[0].startZ <= 0.0f)
+    return false;
+
+  return perf::ReadAllocCounter() == 0 &&
+         perf::GetTotalAllocStats().allocCount == 0;
+}
+
+bool TestFrameHistoryPercentiles() {
+  perf::FrameHistory history{};
+
+  // Overfill the ring so the oldest samples are overwritten.
+  const int total = perf::kFrameHistorySize + 50;
+  for (int i = 0; i < total; ++i) {
+    perf::FrameSample s;
+    s.frameMs = static_cast<float>(i);
+    s.simSteps = 1;
+    s.simClamped = (i % 100) == 0;
+    perf::PushFrameSample(history, s);
+  }
+
+  if (history.count != perf::kFrameHistorySize ||
+      history.totalFrames != static_cast<uint64_t>(total))
+    return false;
+
+  // Window holds [50, total); age 0 is the oldest sample.
+  if (!NearlyEqual(perf::GetFrameSample(history, 0).frameMs, 50.0f) ||
+      !NearlyEqual(
+          perf::GetFrameSample(history, history.count - 1).frameMs,
+          static_cast<float>(total - 1)))
+    return false;
+
+  const perf::FramePercentiles p =
+      perf::ComputeFramePercentiles(history, &perf::FrameSample::frameMs);
+  if (!NearlyEqual(p.max, static_cast<float>(total - 1)))
+    return false;
+  if (!(p.p50 < p.p95 && p.p95 <= p.p99 && p.p99 <= p.max))
+    return false;
+  if (!NearlyEqual(p.p50, 50.0f + perf::kFrameHistorySize / 2))
+    return false;
+
+  // Clamps at 100, 200 and 300 are in the window, 0 was overwritten.
+  return perf::CountClampedFrames(history) == 3 &&
+         history.clampedFrames == 4 &&
+         NearlyEqual(perf::AverageSimSteps(history), 1.0f);
+}
+
+bool TestFramePacerHoldsTargetRate() {
+  using Clock = std::chrono::steady_clock;
+  core::FramePacer pacer{};
+
+  // Uncapped never waits.
+  core::SetFramePacerTarget(pacer, 0);
+  core::WaitForNextFrame(pacer);
+  if (pacer.lastJitterMs != 0.0f)
+    return false;
+
+  // 20 frames at 500 fps must take at least 40 ms (lower bound only, so a
+  // loaded machine cannot make this flaky).
+  core::SetFramePacerTarget(pacer, 500);
+  const auto start = Clock::now();
+  for (int i = 0; i < 20; ++i)
+    core::WaitForNextFrame(pacer);
+  const float elapsedMs =
+      std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+
+  return elapsedMs >= 39.9f &&
+         pacer.spinMarginMs >= cfg::kFramePacerMinSpinMs &&
+         pacer.spinMarginMs <= cfg::kFramePacerMaxSpinMs;
+}
+
+bool TestTripleBufferLatestWins() {
+  core::TripleBuffer<int> buffer;
+  if (buffer.ReadLatest() != nullptr)
+    return false;
+
+  // Two publishes before a read: the reader only sees the newest.
+  buffer.WriteSlot() = 1;
+  buffer.Publish();
+  buffer.WriteSlot() = 2;
+  buffer.Publish();
+  const int *latest = buffer.ReadLatest();
+  if (!latest || *latest != 2)
+    return false;
+
+  // Nothing new: no value, but Front() still holds the last one.
+  if (buffer.ReadLatest() != nullptr || buffer.Front() != 2)
+    return false;
+
+  buffer.WriteSlot() = 3;
+  buffer.Publish();
+  latest = buffer.ReadLatest();
+  return latest && *latest == 3;
+}
+
+bool TestSimThreadPublishesSnapshots() {
+  static SimThread sim; // Large; keep it off the stack
+  Game game{};
+  ResetRun(game, 0x5EEDu, 0); // Endless Mode
+  const float startZ = game.player.position.z;
+
+  StartSimThread(sim, game);
+  uint64_t lastTicks = game.simTicks;
+  bool advanced = false;
+  for (int i = 0; i < 40; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    int steps = 0;
+    bool clamped = false;
+    const float alpha = SyncFromSimThread(sim, game, steps, clamped);
+    if (alpha < 0.0f || alpha > 1.0f || game.simTicks < lastTicks)
+      break;
+    if (game.level != &sim.renderLevel || game.level->segmentCount == 0)
+      break;
+    advanced = advanced || game.simTicks > lastTicks;
+    lastTicks = game.simTicks;
+  }
+  StopSimThread(sim, game);
+
+  // Final state is copied back and the level points at the game's own
+  // generator again.
+  return advanced && !IsSimThreadRunning(sim) && game.simTicks >= lastTicks &&
+         game.player.position.z > startZ &&
+         game.level == &game.endlessGenerator.GetLevel();
+}
+
+bool TestLevelMeshBuilderGeometry() {
+  LevelSegment seg{};
+  seg.startZ = 10.0f;
+  seg.length = 20.0f;
+  seg.topY = 1.0f;
+  seg.width = 6.0f;
+  seg.variantIndex = 0;
+  seg.heightScale = 1.0f;
+  seg.colorTint = 0;
+
+  const LevelPalette &pal = GetPalette(0);
+  render::MeshBuilder builder;
+  render::AppendSegmentGeometry(builder, seg,
+                                render::GetSegmentStyle(seg, pal), pal);
+
+  // Body, top, 2 edges, 2 edge glows, plus one quad per grid line.
+  const int expected = 6 * 36 + cfg::kGridLongitudinalCount * 6;
+  if (builder.VertexCount() != expected ||
+      builder.colors.size() != builder.vertices.size() / 3 * 4)
+    return false;
+  if (!NearlyEqual(builder.minZ, 10.0f) || !NearlyEqual(builder.maxZ, 30.0f))
+    return false;
+
+  // Every box triangle must face away from the box centre (back-face culling
+  // is on when the chunks are drawn).
+  render::MeshBuilder box;
+  const Vector3 c = {1.0f, 2.0f, 3.0f};
+  box.AddBox(c, {2.0f, 4.0f, 6.0f}, WHITE);
+  for (int t = 0; t < box.VertexCount() / 3; ++t) {
+    const float *v = &box.vertices[static_cast<size_t>(t) * 9];
+    const float e1[3] = {v[3] - v[0], v[4] - v[1], v[5] - v[2]};
+    const float e2[3] = {v[6] - v[0], v[7] - v[1], v[8] - v[2]};
+    const float n[3] = {e1[1] * e2[2] - e1[2] * e2[1],
+                        e1[2] * e2[0] - e1[0] * e2[2],
+                        e1[0] * e2[1] - e1[1] * e2[0]};
+    const float out[3] = {(v[0] + v[3] + v[6]) / 3.0f - c.x,
+                          (v[1] + v[4] + v[7]) / 3.0f - c.y,
+                          (v[2] + v[5] + v[8]) / 3.0f - c.z};
+    if (n[0] * out[0] + n[1] * out[1] + n[2] * out[2] <= 0.0f)
+      return false;
+  }
+
+  // Striped variant adds eight stripe boxes; variant 6 drops the grid.
+  seg.variantIndex = 7;
+  builder.Clear();
+  render::AppendSegmentGeometry(builder, seg,
+                                render::GetSegmentStyle(seg, pal), pal);
+  if (builder.VertexCount() != expected + 8 * 36)
+    return false;
+  seg.variantIndex = 6;
+  builder.Clear();
+  render::AppendSegmentGeometry(builder, seg,
+                                render::GetSegmentStyle(seg, pal), pal);
+  return builder.VertexCount() == 6 * 36;
+}
+
+bool TestPrefabVertexTransform() {
+  // Per-vertex attributes stay in step with the mesh.
+  render::PrefabBuilder builder;
+  builder.AddBox({0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, WHITE);
+  builder.AddBox({0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, WHITE,
+                 {2.0f, 0.5f, 0.7f, 0.3f}, 3);
+  if (builder.VertexCount() != 72 ||
+      builder.pulses.size() != static_cast<size_t>(72 * 4) ||
+      builder.groups.size() != 72 || builder.groups[35] != 0.0f ||
+      builder.groups[36] != 3.0f)
+    return false;
+
+  // Scale, then yaw (group + instance), then offset, matching rlRotatef.
+  render::PrefabGroup group;
+  group.scale = 2.0f;
+  group.scaleY = 3.0f;
+  group.yawRad = 0.25f * 3.14159265f;
+  group.instanceYaw = 1.0f;
+  group.offset = {0.0f, 1.0f, 0.0f};
+  group.instanceY = 1.0f;
+  const render::PrefabInstance instance = {{10.0f, 2.0f, 5.0f},
+                                           0.25f * 3.14159265f};
+  const Vector3 p = render::PrefabVertexPosition(group, instance,
+                                                 {1.0f, 1.0f, 0.0f});
+  // 90 degree yaw maps +X to -Z.
+  if (!NearlyEqual(p.x, 10.0f) || !NearlyEqual(p.y, 8.0f) ||
+      !NearlyEqual(p.z, 3.0f))
+    return false;
+
+  const render::PrefabPulse pulse = {2.0f, 0.5f, 0.7f, 0.3f};
+  return NearlyEqual(render::PrefabPulseAlpha(pulse, 0.0f),
+                     0.7f + 0.3f * std::sin(0.5f)) &&
+         NearlyEqual(render::PrefabPulseAlpha({}, 123.0f), 1.0f);
+}
+
+bool TestFrustumCulling() {
+  Camera3D camera = {};
+  camera.position = {0.0f, 0.0f, 0.0f};
+  camera.target = {0.0f, 0.0f, 1.0f};
+  camera.up = {0.0f, 1.0f, 0.0f};
+  camera.fovy = 60.0f;
+  camera.projection = CAMERA_PERSPECTIVE;
+  const render::Frustum f = render::MakeFrustum(camera, 1.0f, 0.1f, 100.0f);
+
+  if (!render::SphereInFrustum(f, {0.0f, 0.0f, 10.0f}, 0.5f) ||
+      render::SphereInFrustum(f, {0.0f, 0.0f, -10.0f}, 0.5f) ||
+      render::SphereInFrustum(f, {50.0f, 0.0f, 10.0f}, 0.5f) ||
+      render::SphereInFrustum(f, {0.0f, 0.0f, 150.0f}, 0.5f))
+    return false;
+  // Straddling a side plane counts as visible.
+  if (!render::SphereInFrustum(f, {6.0f, 0.0f, 10.0f}, 1.0f))
+    return false;
+
+  // A wide box reaches into view even though its centre is off to the side.
+  if (!render::BoxInFrustum(f, {20.0f, 0.0f, 10.0f}, {16.0f, 0.5f, 0.5f}) ||
+      render::BoxInFrustum(f, {20.0f, 0.0f, 10.0f}, {1.0f, 0.5f, 0.5f}))
+    return false;
+
+  // The batch path (four-wide plus scalar tail) agrees with the scalar test.
+  constexpr int kCount = 6;
+  const float x[kCount] = {0.0f, 0.0f, 50.0f, 6.0f, -3.0f, 0.0f};
+  const float y[kCount] = {0.0f, 0.0f, 0.0f, 0.0f, 2.0f, 80.0f};
+  const float z[kCount] = {10.0f, -10.0f, 10.0f, 10.0f, 20.0f, 20.0f};
+  const float r[kCount] = {0.5f, 0.5f, 0.5f, 1.0f, 1.0f, 1.0f};
+  unsigned char visible[kCount] = {};
+  int expected = 0;
+  const int n = render::SpheresInFrustum(f, x, y, z, r, kCount, visible);
+  for (int i = 0; i < kCount; ++i) {
+    const bool in = render::SphereInFrustum(f, {x[i], y[i], z[i]}, r[i]);
+    if ((visible[i] != 0) != in)
+      return false;
+    expected += in ? 1 : 0;
+  }
+  if (n != expected || n != 3)
+    return false;
+
+  // Orthographic cameras are never culled.
+  camera.projection = CAMERA_ORTHOGRAPHIC;
+  const render::Frustum all = render::MakeFrustum(camera, 1.0f, 0.1f, 100.0f);
+  return render::SphereInFrustum(all, {0.0f, 0.0f, -10.0f}, 0.5f);
+}
+
+bool TestEndlessPowerUpGroundHeight() {
+  // Every spawned power-up carries the top of a segment under it, so the
+  // renderer never has to search for it.
+  // Checked after every extension, since the window drops old ones.
+  EndlessLevelGenerator gen;
+  gen.Initialize(1234u);
+  int checked = 0;
+  for (float z = 0.0f; z < 600.0f; z += 50.0f) {
+    gen.ExtendLevel(z, 0.8f);
+    const Level &level = gen.GetLevel();
+    for (int pi = 0; pi < level.powerUpCount; ++pi) {
+      const PowerUp &pu = level.powerUps[pi];
+      bool supported = false;
+      for (int si = 0; si < level.segmentCount && !supported; ++si) {
+        const LevelSegment &seg = level.segments[si];
+        supported = pu.z >= seg.startZ && pu.z <= seg.startZ + seg.length &&
+                    std::fabs(pu.x - seg.xOffset) < seg.width * 0.5f &&
+                    pu.groundY == seg.topY;
+      }
+      if (!supported)
+        return false;
+      ++checked;
+    }
+  }
+  return checked > 0;
+}
+
+bool TestScreenshotQueue() {
+  // More captures than pooled buffers: the extra ones wait for a free
+  // buffer, and every image and sidecar still lands on disk intact.
+  constexpr int kShots = cfg::kScreenshotQueueSlots + 3;
+  unsigned char rgba[4 * 2 * 4];
+  for (int i = 0; i < 4 * 2 * 4; ++i)
+    rgba[i] = static_cast<unsigned char>(i);
+
+  const render::ScreenshotQueueStats before = render::GetScreenshotQueueStats();
+  for (int i = 0; i < kShots; ++i) {
+    render::ScreenshotRequest request;
+    request.path = "sim_tests_shot_" + std::to_string(i) + ".raw";
+    request.sidecarPath = "sim_tests_shot_" + std::to_string(i) + ".json";
+    request.sidecarText = "{\"shot\": " + std::to_string(i) + "}\n";
+    render::QueueScreenshotPixels(std::move(request), rgba, 4, 2);
+  }
+  render::FlushScreenshots();
+  const render::ScreenshotQueueStats after = render::GetScreenshotQueueStats();
+
+  bool ok = after.pending == 0 && after.failed == before.failed &&
+            after.written - before.written == kShots;
+  for (int i = 0; i < kShots; ++i) {
+    const std::string image = "sim_tests_shot_" + std::to_string(i) + ".raw";
+    const std::string sidecar = "sim_tests_shot_" + std::to_string(i) + ".json";
+    unsigned char rgb[4 * 2 * 3 + 1] = {};
+    char text[32] = {};
+    std::FILE *f = std::fopen(image.c_str(), "rb");
+    const size_t rgbSize = f ? std::fread(rgb, 1, sizeof(rgb), f) : 0;
+    if (f)
+      std::fclose(f);
+    f = std::fopen(sidecar.c_str(), "rb");
+    if (f) {
+      (void)std::fread(text, 1, sizeof(text) - 1, f);
+      std::fclose(f);
+    }
+    std::remove(image.c_str());
+    std::remove(sidecar.c_str());
+
+    // Alpha is dropped: RGB8, 3 bytes per pixel.
+    ok = ok && rgbSize == 4 * 2 * 3 && rgb[3] == 4 && rgb[23] == 30 &&
+         std::string(text) == "{\"shot\": " + std::to_string(i) + "}\n";
+  }
+  render::ShutdownScreenshotQueue();
+  return ok;
+}
+
+bool TestYuv420Conversion() {
+  // 3x3 image: white everywhere except a pure red bottom-right pixel. The
+  // odd edge makes a 2x2 chroma plane whose last sample only sees red.
+  unsigned char rgba[3 * 3 * 4];
+  for (int i = 0; i < 3 * 3; ++i) {
+    rgba[i * 4 + 0] = 255;
+    rgba[i * 4 + 1] = 255;
+    rgba[i * 4 + 2] = 255;
+    rgba[i * 4 + 3] = 255;
+  }
+  rgba[8 * 4 + 1] = 0;
+  rgba[8 * 4 + 2] = 0;
+
+  unsigned char yuv[9 + 4 + 4];
+  render::ConvertRgbaToYuv420(rgba, 3, 3, yuv);
+  const unsigned char *u = yuv + 9;
+  const unsigned char *v = u + 4;
+  // BT.601 limited range: white is Y 235 with neutral chroma, red is
+  // Y 82, U 90, V 240.
+  return yuv[0] == 235 && yuv[8] == 82 && u[0] == 128 && v[0] == 128 &&
+         u[3] == 90 && v[3] == 240;
+}
+
+bool TestLodHysteresis() {
+  using render::LodTier;
+  // Without history the thresholds are hard cut-offs.
+  bool ok = render::SelectLod(cfg::kLodReducedPx + 1.0f) == LodTier::Full &&
+            render::SelectLod(cfg::kLodReducedPx - 1.0f) == LodTier::Reduced &&
+            render::SelectLod(cfg::kLodMinimalPx - 1.0f) == LodTier::Minimal;
+
+  // Just past a threshold, an object keeps its tier in either direction.
+  const float reducedBand = cfg::kLodReducedPx * cfg::kLodHysteresis;
+  ok = ok &&
+       render::SelectLod(cfg::kLodReducedPx - reducedBand * 0.5f,
+                         LodTier::Full) == LodTier::Full &&
+       render::SelectLod(cfg::kLodReducedPx + reducedBand * 0.5f,
+                         LodTier::Reduced) == LodTier::Reduced &&
+       render::SelectLod(cfg::kLodReducedPx - reducedBand * 1.5f,
+                         LodTier::Full) == LodTier::Reduced &&
+       render::SelectLod(cfg::kLodReducedPx + reducedBand * 1.5f,
+                         LodTier::Reduced) == LodTier::Full;
+  // Large jumps cross several tiers at once.
+  ok = ok && render::SelectLod(1.0f, LodTier::Full) == LodTier::Minimal &&
+       render::SelectLod(1000.0f, LodTier::Minimal) == LodTier::Full;
+
+  // Projected size falls off with distance and widens with the FOV.
+  Camera3D camera = {};
+  camera.position = {0.0f, 0.0f, 0.0f};
+  camera.target = {0.0f, 0.0f, 1.0f};
+  camera.up = {0.0f, 1.0f, 0.0f};
+  camera.fovy = 60.0f;
+  camera.projection = CAMERA_PERSPECTIVE;
+  render::BeginLodFrame(camera, 720.0f);
+  const float nearPx = render::ProjectedDiameter({0.0f, 0.0f, 10.0f}, 1.0f);
+  const float farPx = render::ProjectedDiameter({0.0f, 0.0f, 20.0f}, 1.0f);
+  camera.fovy = 90.0f;
+  render::BeginLodFrame(camera, 720.0f);
+  const float widePx = render::ProjectedDiameter({0.0f, 0.0f, 10.0f}, 1.0f);
+  return ok && NearlyEqual(nearPx, 2.0f * farPx, 1e-3f) && widePx < nearPx &&
+         NearlyEqual(nearPx, 720.0f / std::tan(30.0f * DEG2RAD) / 10.0f, 1e-3f);
+}
+
+bool TestParticleSwapRemove() {
+  core::ParticleSystem<8> particles;
+  // Seven particles cover both the four-wide kernel and the scalar tail;
+  // the odd ones die on the first step.
+  for (int i = 0; i < 7; ++i) {
+    const float life = (i % 2 == 1) ? 0.005f : 1.0f;
+    particles.Spawn({static_cast<float>(i), 0.0f, 0.0f}, {1.0f, 2.0f, 4.0f},
+                    life);
+  }
+  core::ParticleSystem<2> small;
+  bool ok = small.Spawn({}, {}, 1.0f) && small.Spawn({}, {}, 1.0f) &&
+            !small.Spawn({}, {}, 1.0f) && small.Stats().dropped == 1 &&
+            small.Stats().live == 2;
+
+  const core::ParticleMotion motion = {{2.0f, 0.0f, 0.5f}, -10.0f};
+  const float dt = 0.01f;
+  particles.Update(motion, dt);
+  ok = ok && particles.count == 4;
+
+  // Survivors keep their own state, wherever swap-remove moved them.
+  bool seen[7] = {};
+  for (int i = 0; i < particles.count; ++i) {
+    const int id = static_cast<int>(std::lround(particles.px[i] - 0.0098f));
+    if (id < 0 || id >= 7 || id % 2 == 1 || seen[id])
+      return false;
+    seen[id] = true;
+    const float vx = 1.0f * (1.0f - 2.0f * dt);
+    const float vy = 2.0f - 10.0f * dt;
+    const float vz = 4.0f * (1.0f - 0.5f * dt);
+    ok = ok && NearlyEqual(particles.vx[i], vx) &&
+         NearlyEqual(particles.vy[i], vy) &&
+         NearlyEqual(particles.vz[i], vz) &&
+         NearlyEqual(particles.px[i], static_cast<float>(id) + vx * dt) &&
+         NearlyEqual(particles.py[i], vy * dt) &&
+         NearlyEqual(particles.pz[i], vz * dt) &&
+         NearlyEqual(particles.life[i], 1.0f - dt) &&
+         particles.maxLife[i] == 1.0f;
+  }
+
+  // Everything left dies together and the pool is reusable.
+  particles.Update(motion, 2.0f);
+  return ok && particles.count == 0 && particles.Stats().live == 0 &&
+         particles.Spawn({}, {}, 1.0f);
+}
+
+bool TestParticleRecycle() {
+  // A full pool replaces the particle with the least life left.
+  core::ParticleSystem<5> particles;
+  for (int i = 0; i < 5; ++i) {
+    const float life = i == 3 ? 0.1f : 1.0f;
+    particles.Spawn({static_cast<float>(i), 0.0f, 0.0f}, {}, life);
+  }
+  particles.SpawnOrRecycle({9.0f, 0.0f, 0.0f}, {}, 0.5f);
+  bool ok = particles.count == 5 && particles.px[3] == 9.0f &&
+            particles.life[3] == 0.5f && particles.Stats().dropped == 0 &&
+            particles.Stats().spawned == 6;
+
+  // moveFirst moves with the velocity from before this step's drag, in the
+  // four-wide kernel and the scalar tail alike.
+  const core::ParticleMotion motion = {{2.0f, 2.0f, 2.0f}, 0.0f, true};
+  const float dt = 0.1f;
+  for (int i = 0; i < 5; ++i) {
+    particles.vx[i] = 1.0f;
+    particles.px[i] = 0.0f;
+  }
+  particles.Update(motion, dt);
+  for (int i = 0; i < 5; ++i) {
+    ok = ok && NearlyEqual(particles.px[i], dt) &&
+         NearlyEqual(particles.vx[i], 1.0f - 2.0f * dt);
+  }
+  return ok;
+}
+
+bool TestDrawStatsPasses() {
+  using render::DrawPass;
+  // Disabled, nothing is counted and the last frame stays published.
+  render::SetDrawStatsEnabled(false);
+  render::BeginDrawStatsFrame();
+  render::CountDrawCall(100);
+  render::EndDrawStatsFrame();
+  bool ok = render::GetDrawStats().total.drawCalls == 0;
+
+  render::SetDrawStatsEnabled(true);
+  render::BeginDrawStatsFrame();
+  render::CountDrawCall(6); // Before the first pass: Space
+  render::SetDrawPass(DrawPass::Obstacles);
+  render::CountDrawCall(36 * 10);
+  render::CountStateChange();
+  render::SetDrawPass(DrawPass::Hud);
+  render::CountBatchFlush();
+  render::CountDrawCall(4);
+  render::CountDrawCall(8);
+  render::EndDrawStatsFrame();
+  render::SetDrawStatsEnabled(false);
+
+  const render::DrawStats &stats = render::GetDrawStats();
+  const auto &space = stats.passes[static_cast<int>(DrawPass::Space)];
+  const auto &obstacles = stats.passes[static_cast<int>(DrawPass::Obstacles)];
+  const auto &hud = stats.passes[static_cast<int>(DrawPass::Hud)];
+  const auto &player = stats.passes[static_cast<int>(DrawPass::Player)];
+  return ok && space.drawCalls == 1 && space.vertices == 6 &&
+         obstacles.drawCalls == 1 && obstacles.vertices == 360 &&
+         obstacles.stateChanges == 1 && hud.drawCalls == 2 &&
+         hud.vertices == 12 && hud.batchFlushes == 1 &&
+         player.drawCalls == 0 && stats.total.drawCalls == 4 &&
+         stats.total.vertices == 378 && stats.total.batchFlushes == 1 &&
+         stats.total.stateChanges == 1 &&
+         std::strcmp(render::DrawPassName(DrawPass::PowerUps), "Power-ups") ==
+             0;
+}
+
+bool TestDrawStatsBatchFlushes() {
+  // One rlDrawRenderBatch as rlgl issues it: bind the batch to upload,
+  // unbind, bind again and draw per texture. Then a mesh with its own VAO.
+  render::SetDrawStatsEnabled(true);
+  render::BeginDrawStatsFrame();
+  render::OnGlBindVertexArray(true);
+  render::OnGlBindVertexArray(false);
+  render::OnGlBindVertexArray(true);
+  render::OnGlDraw(6);
+  render::OnGlDraw(12);
+  render::OnGlBindVertexArray(false);
+  render::OnGlBindVertexArray(false);
+  render::OnGlDraw(36);
+  render::EndDrawStatsFrame();
+  render::SetDrawStatsEnabled(false);
+
+  const render::PassDrawStats &total = render::GetDrawStats().total;
+  return total.batchFlushes == 1 && total.drawCalls == 3 &&
+         total.vertices == 54 && total.stateChanges == 5;
+}
+
+// Negative coordinates hash the same at compile time as at runtime.
+constexpr Level kVariantProbe = [] {
+  Level lv{};
+  lv.obstacles[0] = {.z = 12.0f, .x = -2.5f, .y = -0.5f};
+  lv.obstacleCount = 1;
+  AssignVariants(lv);
+  return lv;
+}();
+static_assert(kVariantProbe.obstacles[0].colorIndex >= 0 &&
+              kVariantProbe.obstacles[0].rotation >= 0.0f);
+
+bool TestLevelPreload() {
+  // A preloaded level comes back exactly as the main thread would build it,
+  // once; duplicate requests don't queue it twice.
+  render::PreloadLevel(2, 1);
+  render::PreloadLevel(2, 1);
+  const Level &level = GetLevelByIndex(2);
+  std::vector<render::MeshBuilder> preloaded;
+  bool taken = false;
+  for (int i = 0; i < 500 && !taken; ++i) {
+    taken = render::TakePreloadedLevelMesh(level, 1, preloaded);
+    if (!taken)
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+  const int requested = render::GetLevelPreloadStats().requested;
+
+  std::vector<render::MeshBuilder> built;
+  render::BuildLevelChunks(level, GetPalette(1), built);
+  bool same = taken && !preloaded.empty() && preloaded.size() == built.size();
+  for (size_t i = 0; same && i < preloaded.size(); ++i) {
+    same = preloaded[i].vertices == built[i].vertices &&
+           preloaded[i].colors == built[i].colors;
+  }
+  std::vector<render::MeshBuilder> again;
+  const bool takenTwice = render::TakePreloadedLevelMesh(level, 1, again);
+  render::ShutdownLevelPreloader();
+  return same && requested == 1 && !takenTwice;
+}
+
+bool TestEmbeddedLevelsMatchJson() {
+  // The compiled-in levels are the JSON as the runtime loader reads it.
+  const char *paths[] = {
+      "levels/stage1_level1.json", "levels/stage1_level2.json",
+      "levels/stage1_level3.json", "levels/stage2_level1.json",
+      "levels/stage2_level2.json", "levels/stage2_level3.json"};
+  static Level loaded;
+  bool ok = true;
+  for (int i = 0; i < 6; ++i) {
+    ok = ok && LoadLevelFromFile(loaded, paths[i]) &&
+         GetLevelByIndex(i + 1) == loaded;
+  }
+  Level probe = kVariantProbe;
+  probe.obstacles[0].shape = ObstacleShape::Unset;
+  probe.obstacles[0].rotation = -999.0f;
+  probe.obstacles[0].colorIndex = -1;
+  AssignVariants(probe);
+  return ok && probe == kVariantProbe;
+}
+
+bool TestLevelPackRoundTrip() {
+  const char *path = "sim_tests_levels.pack";
+  static Level levels[2];
+  const char *names[] = {"levels/first.json", "levels/second.json"};
+  bool ok = LoadLevelFromFile(levels[0], "levels/stage1_level1.json") &&
+            LoadLevelFromFile(levels[1], "levels/stage2_level3.json") &&
+            WriteLevelPack(path, names, levels, 2);
+
+  // Levels come back variant-assigned, in place and aligned.
+  LevelPack pack;
+  ok = ok && OpenLevelPack(pack, path);
+  const Level *second = FindPackedLevel(pack, names[1]);
+  ok = ok && second && *second == levels[1] &&
+       second->segments[0].variantIndex >= 0 &&
+       reinterpret_cast<uintptr_t>(second) % alignof(Level) == 0 &&
+       FindPackedLevel(pack, "levels/third.json") == nullptr;
+  CloseLevelPack(pack);
+
+  // A flipped byte anywhere after the header rejects the whole pack.
+  std::FILE *f = std::fopen(path, "r+b");
+  if (f) {
+    std::fseek(f, -64, SEEK_END);
+    const int byte = std::fgetc(f);
+    std::fseek(f, -64, SEEK_END);
+    std::fputc(byte ^ 0xFF, f);
+    std::fclose(f);
+  }
+  ok = ok && f && !OpenLevelPack(pack, path) && pack.header == nullptr;
+  std::remove(path);
+  return ok;
+}
+
+bool TestImageDiff() {
+  constexpr int kSize = 16;
+  // Black with a white bar in columns [bar, bar + 4); optionally a red
+  // block in the corner.
+  auto fill = [](unsigned char *image, int bar, bool block) {
+    for (int y = 0; y < kSize; ++y) {
+      for (int x = 0; x < kSize; ++x) {
+        unsigned char *p = image + (y * kSize + x) * 4;
+        const bool white = x >= bar && x < bar + 4;
+        const bool red = block && x >= 10 && x < 13 && y >= 10 && y < 13;
+        p[0] = (white || red) ? 255 : 0;
+        p[1] = p[2] = white ? 255 : 0;
+        p[3] = 255;
+      }
+    }
+  };
+  unsigned char expected[kSize * kSize * 4];
+  unsigned char actual[kSize * kSize * 4];
+  unsigned char heatmap[kSize * kSize * 4];
+  const core::ImageDiffOptions options;
+  fill(expected, 4, false);
+
+  fill(actual, 4, false);
+  const auto same = core::DiffImages(expected, actual, kSize, kSize, options);
+  bool ok = same.differentPixels == 0 && same.shiftedPixels == 0 &&
+            same.meanDelta == 0.0 &&
+            core::PixelDelta(expected, expected + 4 * 4) > 0.9f;
+
+  // The bar moving one pixel only shifts its two edge columns.
+  fill(actual, 5, false);
+  const auto moved =
+      core::DiffImages(expected, actual, kSize, kSize, options, heatmap);
+  ok = ok && moved.differentPixels == 0 && moved.shiftedPixels == 2 * kSize &&
+       moved.DifferentFraction() == 0.0 && heatmap[4 * 4 + 1] == 220 &&
+       heatmap[5 * 4] == 63 && heatmap[5 * 4 + 3] == 255;
+
+  // Without a neighbourhood the same edges differ.
+  core::ImageDiffOptions strict;
+  strict.radius = 0;
+  ok = ok && core::DiffImages(expected, actual, kSize, kSize, strict)
+                     .differentPixels == 2 * kSize;
+
+  // A new object has nothing nearby to match, so every pixel differs.
+  fill(actual, 4, true);
+  const auto added =
+      core::DiffImages(expected, actual, kSize, kSize, options, heatmap);
+  const unsigned char *hot = heatmap + (11 * kSize + 11) * 4;
+  return ok && added.differentPixels == 9 && added.shiftedPixels == 0 &&
+         NearlyEqual(static_cast<float>(added.DifferentFraction()),
+                     9.0f / (kSize * kSize)) &&
+         added.maxDelta > options.threshold && hot[0] == 255 &&
+         hot[1] < 160 && hot[2] == 0;
+}
+
+bool TestLevelHotReload() {
+  // The watcher reports a finished write by file name.
+  const char *dir = "sim_tests_watch";
+  std::filesystem::create_directory(dir);
+  std::atomic<bool> seen{false};
+  core::FileWatcher watcher;
+  bool ok = core::StartFileWatcher(watcher, dir, [&](const std::string &name) {
+    if (name == "stage9_level9.json")
+      seen = true;
+  });
+  if (ok) {
+    std::FILE *f = std::fopen("sim_tests_watch/stage9_level9.json", "wb");
+    ok = f && std::fputs("{}", f) >= 0 && std::fclose(f) == 0;
+  }
+  for (int i = 0; ok && i < 1000 && !seen; ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  core::StopFileWatcher(watcher);
+  std::filesystem::remove_all(dir);
+  ok = ok && seen;
+
+  // A replaced built-in level is what GetLevelByIndex returns from then on.
+  // Versions live in a fixed ring, so storage comes round again after
+  // kBuiltinLevelVersions replacements instead of growing.
+  ok = ok && FindBuiltinLevelIndex("levels/stage2_level3.json") == 6 &&
+       FindBuiltinLevelIndex("levels/stage9_level9.json") == 0;
+  const Level previous = GetLevelByIndex(6);
+  Level edited = previous;
+  edited.segments[0].width += 1.0f;
+  const Level &latest = ReplaceBuiltinLevel(6, edited);
+  ok = ok && &GetLevelByIndex(6) == &latest &&
+       latest.segments[0].width == previous.segments[0].width + 1.0f;
+  for (int i = 1; i < kBuiltinLevelVersions; ++i) {
+    ok = ok && &ReplaceBuiltinLevel(6, previous) != &latest &&
+         latest.segments[0].width == previous.segments[0].width + 1.0f;
+  }
+  ok = ok && &ReplaceBuiltinLevel(6, previous) == &latest;
+  return ok && GetLevelByIndex(6) == previous;
+}
+
 } // namespace
 
 int main() {
@@ -788,6 +1560,28 @@ int main() {
   run("start_zone_spawn_safe", TestStartZoneSpawnSafe());
   run("start_zone_deterministic", TestStartZoneDeterministic());
   run("start_zone_placeholder_level", TestStartZonePlaceholderLevel());
+  run("endless_sim_step_zero_allocations",
+      TestEndlessSimStepZeroAllocations());
+  run("frame_history_percentiles", TestFrameHistoryPercentiles());
+  run("frame_pacer_holds_target_rate", TestFramePacerHoldsTargetRate());
+  run("triple_buffer_latest_wins", TestTripleBufferLatestWins());
+  run("sim_thread_publishes_snapshots", TestSimThreadPublishesSnapshots());
+  run("level_mesh_builder_geometry", TestLevelMeshBuilderGeometry());
+  run("prefab_vertex_transform", TestPrefabVertexTransform());
+  run("frustum_culling", TestFrustumCulling());
+  run("endless_power_up_ground_height", TestEndlessPowerUpGroundHeight());
+  run("screenshot_queue", TestScreenshotQueue());
+  run("yuv420_conversion", TestYuv420Conversion());
+  run("lod_hysteresis", TestLodHysteresis());
+  run("particle_swap_remove", TestParticleSwapRemove());
+  run("particle_recycle", TestParticleRecycle());
+  run("draw_stats_passes", TestDrawStatsPasses());
+  run("draw_stats_batch_flushes", TestDrawStatsBatchFlushes());
+  run("image_diff", TestImageDiff());
+  run("level_pack_round_trip", TestLevelPackRoundTrip());
+  run("embedded_levels_match_json", TestEmbeddedLevelsMatchJson());
+  run("level_preload", TestLevelPreload());
+  run("level_hot_reload", TestLevelHotReload());
 
   Log::Shutdown();
   return (failed == 0) ? 0 : 1;
@@ -0,0 +1,281 @@
+// golden_diff — compare rendered images against stored goldens
+//
+// Pairs every PNG in the golden directory with the same file name in the
+// actual directory and compares them with the tolerant perceptual metric in
+// core/ImageDiff. Comparisons run on a pool of worker threads, one image at
+// a time per worker. Heatmaps of failing images (or of all images with
+// --all-heatmaps) go to a separate directory for review.
+//
+// Usage:
+//   golden_diff [options] <golden_dir> <actual_dir>
+//     --threshold <0..1>       Per-pixel perceptual distance treated as equal (default: 0.1)
+//     --radius <n>             Neighbourhood for shifted-edge tolerance (default: 1)
+//     --max-diff <percent>     Different pixels allowed per image (default: 0.1)
+//     --heatmaps <dir>         Write <name>.diff.png heatmaps of failing images here
+//     --all-heatmaps           Write heatmaps of passing images too
+//     --jobs <n>               Worker threads (default: hardware concurrency)
+//     --json                   Output as JSON instead of plain text
+//     -h, --help               Print usage
+//
+// Exit code: 0 when every golden has a matching image within tolerance,
+// 1 when any comparison fails or an image is missing, 2 on usage errors.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <raylib.h>
+
+#include "core/ImageDiff.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct DiffArgs {
+    std::string goldenDir;
+    std::string actualDir;
+    std::string heatmapDir;
+    core::ImageDiffOptions options;
+    double maxDiffPercent = 0.1;
+    bool allHeatmaps = false;
+    int jobs = 0;  // 0 = hardware concurrency
+    bool json = false;
+    bool help = false;
+    bool valid = true;
+};
+
+enum class Outcome { Pass, Fail, Missing, SizeMismatch, New };
+
+const char* OutcomeName(Outcome outcome) {
+    switch (outcome) {
+        case Outcome::Pass: return "PASS";
+        case Outcome::Fail: return "FAIL";
+        case Outcome::Missing: return "MISSING";
+        case Outcome::SizeMismatch: return "SIZE";
+        case Outcome::New: return "NEW";
+    }
+    return "?";
+}
+
+struct Comparison {
+    std::string name;
+    Outcome outcome = Outcome::Missing;
+    core::ImageDiffResult result;
+    std::string heatmapPath;  // Empty when none was written
+};
+
+DiffArgs ParseArgs(int argc, char** argv) {
+    DiffArgs args;
+    std::vector<const char*> positional;
+    for (int i = 1; i < argc; ++i) {
+        if ((std::strcmp(argv[i], "--threshold") == 0) && i + 1 < argc) {
+            args.options.threshold = static_cast<float>(std::atof(argv[++i]));
+        } else if ((std::strcmp(argv[i], "--radius") == 0) && i + 1 < argc) {
+            args.options.radius = std::max(0, std::atoi(argv[++i]));
+        } else if ((std::strcmp(argv[i], "--max-diff") == 0) && i + 1 < argc) {
+            args.maxDiffPercent = std::atof(argv[++i]);
+        } else if ((std::strcmp(argv[i], "--heatmaps") == 0) && i + 1 < argc) {
+            args.heatmapDir = argv[++i];
+        } else if (std::strcmp(argv[i], "--all-heatmaps") == 0) {
+            args.allHeatmaps = true;
+        } else if ((std::strcmp(argv[i], "--jobs") == 0) && i + 1 < argc) {
+            args.jobs = std::max(0, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--json") == 0) {
+            args.json = true;
+        } else if (std::strcmp(argv[i], "-h") == 0 || std::strcmp(argv[i], "--help") == 0) {
+            args.help = true;
+        } else if (argv[i][0] == '-') {
+            std::fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            args.valid = false;
+        } else {
+            positional.push_back(argv[i]);
+        }
+    }
+    if (positional.size() == 2) {
+        args.goldenDir = positional[0];
+        args.actualDir = positional[1];
+    } else if (!args.help) {
+        args.valid = false;
+    }
+    return args;
+}
+
+void PrintUsage() {
+    std::printf(
+        "golden_diff — compare rendered images against stored goldens\n"
+        "\n"
+        "Usage: golden_diff [options] <golden_dir> <actual_dir>\n"
+        "  --threshold <0..1>       Per-pixel perceptual distance treated as equal (default: 0.1)\n"
+        "  --radius <n>             Neighbourhood for shifted-edge tolerance (default: 1)\n"
+        "  --max-diff <percent>     Different pixels allowed per image (default: 0.1)\n"
+        "  --heatmaps <dir>         Write <name>.diff.png heatmaps of failing images\n"
+        "  --all-heatmaps           Write heatmaps of passing images too\n"
+        "  --jobs <n>               Worker threads (default: hardware concurrency)\n"
+        "  --json                   Output as JSON\n"
+        "  -h, --help               Print usage\n");
+}
+
+std::vector<std::string> ListPngs(const std::string& dir) {
+    std::vector<std::string> names;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(dir, ec)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".png") {
+            names.push_back(entry.path().filename().string());
+        }
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+void Compare(const DiffArgs& args, Comparison& cmp) {
+    const std::string goldenPath = (fs::path(args.goldenDir) / cmp.name).string();
+    const std::string actualPath = (fs::path(args.actualDir) / cmp.name).string();
+    if (!fs::exists(actualPath)) {
+        cmp.outcome = Outcome::Missing;
+        return;
+    }
+
+    Image golden = LoadImage(goldenPath.c_str());
+    Image actual = LoadImage(actualPath.c_str());
+    if (golden.data == nullptr || actual.data == nullptr ||
+        golden.width != actual.width || golden.height != actual.height) {
+        cmp.outcome = Outcome::SizeMismatch;
+        UnloadImage(golden);
+        UnloadImage(actual);
+        return;
+    }
+    ImageFormat(&golden, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    ImageFormat(&actual, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    const bool wantHeatmap = !args.heatmapDir.empty();
+    std::vector<unsigned char> heatmap;
+    if (wantHeatmap) {
+        heatmap.resize(static_cast<size_t>(golden.width) * golden.height * 4);
+    }
+    cmp.result = core::DiffImages(static_cast<const unsigned char*>(golden.data),
+                                  static_cast<const unsigned char*>(actual.data),
+                                  golden.width, golden.height, args.options,
+                                  wantHeatmap ? heatmap.data() : nullptr);
+    cmp.outcome = cmp.result.DifferentFraction() * 100.0 <= args.maxDiffPercent
+                      ? Outcome::Pass
+                      : Outcome::Fail;
+
+    if (wantHeatmap && (cmp.outcome == Outcome::Fail || args.allHeatmaps)) {
+        const std::string stem = fs::path(cmp.name).stem().string();
+        const std::string path = (fs::path(args.heatmapDir) / (stem + ".diff.png")).string();
+        Image image = {heatmap.data(), golden.width, golden.height, 1,
+                       PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        if (ExportImage(image, path.c_str())) {
+            cmp.heatmapPath = path;
+        }
+    }
+    UnloadImage(golden);
+    UnloadImage(actual);
+}
+
+void PrintJson(const std::vector<Comparison>& comparisons, int failures) {
+    std::printf("{\n");
+    std::printf("  \"passed\": %s,\n", failures == 0 ? "true" : "false");
+    std::printf("  \"failures\": %d,\n", failures);
+    std::printf("  \"images\": [\n");
+    for (size_t i = 0; i < comparisons.size(); ++i) {
+        const Comparison& c = comparisons[i];
+        std::printf("    {\"name\": \"%s\", \"result\": \"%s\", \"different_pct\": %.4f, "
+                    "\"shifted_pixels\": %d, \"max_delta\": %.3f, \"mean_delta\": %.5f, "
+                    "\"heatmap\": \"%s\"}%s\n",
+                    c.name.c_str(), OutcomeName(c.outcome),
+                    c.result.DifferentFraction() * 100.0, c.result.shiftedPixels,
+                    c.result.maxDelta, c.result.meanDelta, c.heatmapPath.c_str(),
+                    i + 1 < comparisons.size() ? "," : "");
+    }
+    std::printf("  ]\n");
+    std::printf("}\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const DiffArgs args = ParseArgs(argc, argv);
+    if (args.help) {
+        PrintUsage();
+        return 0;
+    }
+    if (!args.valid) {
+        PrintUsage();
+        return 2;
+    }
+    if (!fs::is_directory(args.goldenDir)) {
+        std::fprintf(stderr, "Golden directory not found: %s\n", args.goldenDir.c_str());
+        return 2;
+    }
+    if (!args.heatmapDir.empty()) {
+        std::error_code ec;
+        fs::create_directories(args.heatmapDir, ec);
+    }
+    SetTraceLogLevel(LOG_WARNING);
+
+    const std::vector<std::string> goldenNames = ListPngs(args.goldenDir);
+    std::vector<Comparison> comparisons;
+    for (const std::string& name : goldenNames) {
+        Comparison cmp;
+        cmp.name = name;
+        comparisons.push_back(cmp);
+    }
+    // Renders without a golden fail too, so a new scene can't go unreviewed.
+    for (const std::string& name : ListPngs(args.actualDir)) {
+        if (!std::binary_search(goldenNames.begin(), goldenNames.end(), name)) {
+            Comparison cmp;
+            cmp.name = name;
+            cmp.outcome = Outcome::New;
+            comparisons.push_back(cmp);
+        }
+    }
+
+    // Workers take the next unclaimed golden until none are left.
+    const int hardware = static_cast<int>(std::thread::hardware_concurrency());
+    const int workerCount = std::max(1, std::min(args.jobs > 0 ? args.jobs : hardware,
+                                                 static_cast<int>(goldenNames.size())));
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> workers;
+    for (int w = 0; w < workerCount; ++w) {
+        workers.emplace_back([&]() {
+            for (size_t i = next++; i < goldenNames.size(); i = next++) {
+                Compare(args, comparisons[i]);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    int failures = 0;
+    for (const Comparison& c : comparisons) {
+        if (c.outcome != Outcome::Pass) ++failures;
+    }
+
+    if (args.json) {
+        PrintJson(comparisons, failures);
+    } else {
+        for (const Comparison& c : comparisons) {
+            if (c.outcome == Outcome::Pass || c.outcome == Outcome::Fail) {
+                std::printf("%-7s %-40s %7.3f%% different  %6d shifted  max %.3f%s%s\n",
+                            OutcomeName(c.outcome), c.name.c_str(),
+                            c.result.DifferentFraction() * 100.0, c.result.shiftedPixels,
+                            c.result.maxDelta, c.heatmapPath.empty() ? "" : "  -> ",
+                            c.heatmapPath.c_str());
+            } else {
+                std::printf("%-7s %s\n", OutcomeName(c.outcome), c.name.c_str());
+            }
+        }
+        std::printf("%zu images, %d failed (%d workers)\n", comparisons.size(), failures,
+                    workerCount);
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,282 @@
+// levelc — compile level JSON into a binary level pack
+//
+// Parses each level with the game's own loader (including AssignVariants) and
+// writes the resulting Level structs into a pack the game maps at startup,
+// overriding its built-in levels (see sim/LevelPack.hpp). Each level is
+// stored under "levels/<file name>", the asset path the game looks it up by.
+//
+// With --emit-cpp it instead writes a header of constexpr Level definitions,
+// one per file (stage1_level1.json -> kStage1Level1), with AssignVariants run
+// by the compiler. The build embeds the shipped levels this way.
+//
+// Usage:
+//   levelc [options] <level.json>...
+//     -o, --output <path>      Pack to write (default: assets/levels/levels.pack)
+//     --check <path>           Verify an existing pack against the JSON instead of writing
+//     --emit-cpp <path>        Write constexpr Level definitions instead of a pack
+//     -h, --help               Print usage
+//
+// Exit code: 0 on success, 1 when a level fails to load, the output can't be
+// written or --check finds a stale or invalid pack, 2 on usage errors.
+
+#include <cctype>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include "core/Log.hpp"
+#include "sim/Level.hpp"
+#include "sim/LevelPack.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct LevelcArgs {
+    std::string output = "assets/levels/levels.pack";
+    std::string check;
+    std::string emitCpp;
+    std::vector<std::string> inputs;
+    bool help = false;
+    bool valid = true;
+};
+
+LevelcArgs ParseArgs(int argc, char** argv) {
+    LevelcArgs args;
+    for (int i = 1; i < argc; ++i) {
+        if ((std::strcmp(argv[i], "-o") == 0 || std::strcmp(argv[i], "--output") == 0) &&
+            i + 1 < argc) {
+            args.output = argv[++i];
+        } else if ((std::strcmp(argv[i], "--check") == 0) && i + 1 < argc) {
+            args.check = argv[++i];
+        } else if ((std::strcmp(argv[i], "--emit-cpp") == 0) && i + 1 < argc) {
+            args.emitCpp = argv[++i];
+        } else if (std::strcmp(argv[i], "-h") == 0 || std::strcmp(argv[i], "--help") == 0) {
+            args.help = true;
+        } else if (argv[i][0] == '-') {
+            std::fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            args.valid = false;
+        } else {
+            args.inputs.push_back(argv[i]);
+        }
+    }
+    if (args.inputs.empty() && !args.help) {
+        args.valid = false;
+    }
+    return args;
+}
+
+void PrintUsage() {
+    std::printf(
+        "levelc — compile level JSON into a binary level pack\n"
+        "\n"
+        "Usage: levelc [options] <level.json>...\n"
+        "  -o, --output <path>      Pack to write (default: assets/levels/levels.pack)\n"
+        "  --check <path>           Verify an existing pack against the JSON instead of writing\n"
+        "  --emit-cpp <path>        Write constexpr Level definitions instead of a pack\n"
+        "  -h, --help               Print usage\n");
+}
+
+// Float literal that reads back as exactly `value`.
+std::string F(float value) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.9g", static_cast<double>(value));
+    std::string literal = buf;
+    if (literal.find_first_of(".e") == std::string::npos) {
+        literal += ".0";
+    }
+    return literal + "f";
+}
+
+// stage1_level1.json -> kStage1Level1
+std::string Identifier(const std::string& path) {
+    std::string id = "k";
+    bool upper = true;
+    for (char c : fs::path(path).stem().string()) {
+        if (!std::isalnum(static_cast<unsigned char>(c))) {
+            upper = true;
+            continue;
+        }
+        id += upper ? static_cast<char>(std::toupper(static_cast<unsigned char>(c))) : c;
+        upper = false;
+    }
+    return id;
+}
+
+void Append(std::string& out, const char* fmt, ...) {
+    char buf[512];
+    va_list args;
+    va_start(args, fmt);
+    std::vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    out += buf;
+}
+
+// Levels as parsed, before AssignVariants; the generated code runs it.
+std::string EmitLevel(const std::string& path, const Level& lv) {
+    std::string out;
+    Append(out, "// levels/%s\n", fs::path(path).filename().string().c_str());
+    Append(out, "inline constexpr Level %s = [] {\n", Identifier(path).c_str());
+    out += "  Level lv{};\n";
+    for (int i = 0; i < lv.segmentCount; ++i) {
+        const LevelSegment& s = lv.segments[i];
+        Append(out,
+               "  lv.segments[%d] = {.startZ = %s, .length = %s, .topY = %s, .width = %s, "
+               ".xOffset = %s, .variantIndex = %d, .heightScale = %s, .colorTint = %d};\n",
+               i, F(s.startZ).c_str(), F(s.length).c_str(), F(s.topY).c_str(),
+               F(s.width).c_str(), F(s.xOffset).c_str(), s.variantIndex,
+               F(s.heightScale).c_str(), s.colorTint);
+    }
+    Append(out, "  lv.segmentCount = %d;\n", lv.segmentCount);
+    for (int i = 0; i < lv.obstacleCount; ++i) {
+        const LevelObstacle& o = lv.obstacles[i];
+        Append(out,
+               "  lv.obstacles[%d] = {.z = %s, .x = %s, .y = %s, .sizeX = %s, .sizeY = %s, "
+               ".sizeZ = %s, .colorIndex = %d, .shape = static_cast<ObstacleShape>(%d), "
+               ".rotation = %s};\n",
+               i, F(o.z).c_str(), F(o.x).c_str(), F(o.y).c_str(), F(o.sizeX).c_str(),
+               F(o.sizeY).c_str(), F(o.sizeZ).c_str(), o.colorIndex,
+               static_cast<int>(o.shape), F(o.rotation).c_str());
+    }
+    Append(out, "  lv.obstacleCount = %d;\n", lv.obstacleCount);
+    for (int i = 0; i < lv.powerUpCount; ++i) {
+        const PowerUp& p = lv.powerUps[i];
+        Append(out,
+               "  lv.powerUps[%d] = {.z = %s, .x = %s, .y = %s, .groundY = %s, "
+               ".type = static_cast<PowerUpType>(%d), .active = %s};\n",
+               i, F(p.z).c_str(), F(p.x).c_str(), F(p.y).c_str(), F(p.groundY).c_str(),
+               static_cast<int>(p.type), p.active ? "true" : "false");
+    }
+    Append(out, "  lv.powerUpCount = %d;\n", lv.powerUpCount);
+    Append(out, "  lv.totalLength = %s;\n", F(lv.totalLength).c_str());
+    const StartZone& sz = lv.start;
+    Append(out,
+           "  lv.start = {.spawnZ = %s, .gateZ = %s, .zoneDepth = %s, "
+           ".style = static_cast<StartStyle>(%d), .width = %s, .xOffset = %s, .topY = %s, "
+           ".pylonSpacing = %s, .glowIntensity = %s, .stripeCount = %d, .ringCount = %s};\n",
+           F(sz.spawnZ).c_str(), F(sz.gateZ).c_str(), F(sz.zoneDepth).c_str(),
+           static_cast<int>(sz.style), F(sz.width).c_str(), F(sz.xOffset).c_str(),
+           F(sz.topY).c_str(), F(sz.pylonSpacing).c_str(), F(sz.glowIntensity).c_str(),
+           sz.stripeCount, F(sz.ringCount).c_str());
+    const FinishZone& fz = lv.finish;
+    Append(out,
+           "  lv.finish = {.startZ = %s, .endZ = %s, .style = static_cast<FinishStyle>(%d), "
+           ".width = %s, .xOffset = %s, .topY = %s, .ringCount = %s, .glowIntensity = %s, "
+           ".hasRunway = %s};\n",
+           F(fz.startZ).c_str(), F(fz.endZ).c_str(), static_cast<int>(fz.style),
+           F(fz.width).c_str(), F(fz.xOffset).c_str(), F(fz.topY).c_str(),
+           F(fz.ringCount).c_str(), F(fz.glowIntensity).c_str(),
+           fz.hasRunway ? "true" : "false");
+    out += "  AssignVariants(lv);\n";
+    out += "  return lv;\n";
+    out += "}();\n";
+    return out;
+}
+
+bool EmitCpp(const std::string& path, const std::vector<std::string>& inputs,
+             const Level* levels) {
+    std::string out =
+        "// Generated by levelc --emit-cpp from the level JSON. Do not edit.\n"
+        "#pragma once\n"
+        "\n"
+        "#include \"sim/Level.hpp\"\n"
+        "#include \"sim/LevelVariantAssigner.hpp\"\n"
+        "\n"
+        "namespace generated_levels {\n";
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        out += "\n" + EmitLevel(inputs[i], levels[i]);
+    }
+    out += "\n}  // namespace generated_levels\n";
+
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) {
+        return false;
+    }
+    const bool ok = std::fwrite(out.data(), 1, out.size(), f) == out.size();
+    return std::fclose(f) == 0 && ok;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const LevelcArgs args = ParseArgs(argc, argv);
+    if (args.help) {
+        PrintUsage();
+        return 0;
+    }
+    if (!args.valid) {
+        PrintUsage();
+        return 2;
+    }
+    // Loader errors go to stderr; no skyroads.log in the build tree.
+    Log::GetLogger() = spdlog::stderr_color_st("levelc");
+
+    // Level is several KB; keep the batch off the stack.
+    const size_t count = args.inputs.size();
+    auto levels = std::make_unique<Level[]>(count);
+    std::vector<std::string> names(count);
+    std::vector<const char*> namePtrs(count);
+    const bool emitCpp = !args.emitCpp.empty();
+    for (size_t i = 0; i < count; ++i) {
+        if (!LoadLevelFromPath(levels[i], args.inputs[i].c_str(), !emitCpp)) {
+            std::fprintf(stderr, "levelc: failed to load %s\n", args.inputs[i].c_str());
+            return 1;
+        }
+        names[i] = "levels/" + fs::path(args.inputs[i]).filename().string();
+        namePtrs[i] = names[i].c_str();
+    }
+
+    std::error_code ec;
+    const fs::path outputDir =
+        fs::path(emitCpp ? args.emitCpp : args.output).parent_path();
+    if (!outputDir.empty()) {
+        fs::create_directories(outputDir, ec);
+    }
+
+    if (emitCpp) {
+        if (!EmitCpp(args.emitCpp, args.inputs, levels.get())) {
+            std::fprintf(stderr, "levelc: failed to write %s\n", args.emitCpp.c_str());
+            return 1;
+        }
+        std::printf("%s: %zu levels\n", args.emitCpp.c_str(), count);
+        return 0;
+    }
+
+    if (!args.check.empty()) {
+        LevelPack pack;
+        if (!OpenLevelPack(pack, args.check.c_str())) {
+            std::fprintf(stderr, "levelc: %s is missing or invalid\n", args.check.c_str());
+            return 1;
+        }
+        int stale = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const Level* packed = FindPackedLevel(pack, namePtrs[i]);
+            if (!packed || *packed != levels[i]) {
+                std::fprintf(stderr, "levelc: %s is %s\n", namePtrs[i],
+                             packed ? "out of date" : "missing from the pack");
+                ++stale;
+            }
+        }
+        CloseLevelPack(pack);
+        if (stale == 0) {
+            std::printf("%s: %zu levels up to date\n", args.check.c_str(), count);
+        }
+        return stale == 0 ? 0 : 1;
+    }
+
+    if (!WriteLevelPack(args.output.c_str(), namePtrs.data(), levels.get(),
+                        static_cast<int>(count))) {
+        std::fprintf(stderr, "levelc: failed to write %s\n", args.output.c_str());
+        return 1;
+    }
+    std::printf("%s: %zu levels, %ju bytes\n", args.output.c_str(), count,
+                static_cast<uintmax_t>(fs::file_size(args.output, ec)));
+    return 0;
+}
@@ -14,13 +14,24 @@
 //     --bloom                       Enable bloom effect (default: off)
 //     --screenshots                  Enable screenshot capture
 //     --screenshot-output <dir>      Output directory (default: docs/screenshots-raw)
+//     --screenshot-format <fmt>     Image encoding: png|qoi|raw (default: png)
 //     --screenshot-interval <n>     Take screenshot every N ticks (0 = disabled)
 //     --screenshot-at-ticks <list>   Comma-separated list of ticks to screenshot
 //     --screenshot-at-distance <list> Comma-separated list of distances to screenshot
+//     --record <path|"|cmd">        Stream every rendered frame to a file or pipe
+//     --record-format <fmt>         Stream format: y4m|raw (RGB24) (default: y4m)
+//     --record-fps <n>              Output frame rate in sim time (default: 60)
+//     --record-timestamps <path>    Per-frame tick/time CSV (default: <path>.csv for files)
+//     --offscreen                   Render screenshots into a render texture (no presenting)
+//     --headless                    Offscreen with no display server (GLFW null platform, OSMesa)
+//     --resolution <WxH>            Screenshot image size (default: window size)
+//     --msaa <0|4>                  MSAA samples for the window path (default: 4)
 //     --json                        Output as JSON instead of plain text
 //     --quiet                       Only output final summary line
 //     -h, --help                    Print usage
 
+#include <algorithm>
+#include <cctype>
 #include <chrono>
 #include <cstdint>
 #include <cstdio>
@@ -29,7 +40,8 @@
 #include <cmath>
 #include <string>
 #include <vector>
-#include <fstream>
+#include <sstream>
+#include <utility>
 #include <ctime>
 
 #ifdef _WIN32
@@ -41,12 +53,22 @@
 #endif
 
 #include "core/Config.hpp"
+#include "core/PerfTracker.hpp"
 #include "core/Rng.hpp"
 #include "game/Game.hpp"
 #include "sim/Bot.hpp"
 #include "sim/Sim.hpp"
 #include <raylib.h>
+#include "render/DrawStats.hpp"
+#include "render/FrameRecorder.hpp"
+#include "render/FrameTarget.hpp"
 #include "render/Render.hpp"
+#include "render/ScreenshotQueue.hpp"
+
+#if defined(SKYROADS_GLFW_NULL_PLATFORM)
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#endif
 
 namespace {
 
@@ -59,9 +81,19 @@ struct RunnerArgs {
     bool bloomEnabled = false;      // Bloom effect
     bool enableScreenshots = false; // Enable screenshot capture
     std::string screenshotOutputDir = "docs/screenshots-raw";
+    std::string screenshotFormat = "png"; // png|qoi|raw (headerless RGB8)
     int screenshotInterval = 0;     // Take screenshot every N ticks (0 = disabled)
     std::vector<int> screenshotAtTicks;      // Specific ticks to screenshot
     std::vector<float> screenshotAtDistance; // Specific distances to screenshot
+    std::string recordPath;         // Video stream file or "|command" (empty = off)
+    render::VideoFormat recordFormat = render::VideoFormat::Y4m;
+    int recordFps = 60;             // Frames per second of sim time
+    std::string recordTimestamps;   // Timestamp CSV (empty = derive from recordPath)
+    bool offscreen = false;         // Render into a texture instead of the window
+    bool headless = false;          // No display server; implies offscreen
+    int outputWidth = cfg::kScreenWidth;   // Screenshot image size
+    int outputHeight = cfg::kScreenHeight;
+    int msaa = -1;                  // Window path only (0 or 4); -1 = default (4)
     bool json = false;
     bool quiet = false;
     bool help = false;
@@ -153,12 +185,41 @@ RunnerArgs ParseArgs(int argc, char* argv[]) {
             args.enableScreenshots = true;
         } else if ((std::strcmp(argv[i], "--screenshot-output") == 0) && i + 1 < argc) {
             args.screenshotOutputDir = argv[++i];
+        } else if ((std::strcmp(argv[i], "--screenshot-format") == 0) && i + 1 < argc) {
+            const char* format = argv[++i];
+            if (std::strcmp(format, "qoi") == 0 || std::strcmp(format, "raw") == 0) {
+                args.screenshotFormat = format;
+            } else {
+                args.screenshotFormat = "png";
+            }
         } else if ((std::strcmp(argv[i], "--screenshot-interval") == 0) && i + 1 < argc) {
             args.screenshotInterval = std::atoi(argv[++i]);
         } else if ((std::strcmp(argv[i], "--screenshot-at-ticks") == 0) && i + 1 < argc) {
             args.screenshotAtTicks = ParseIntList(argv[++i]);
         } else if ((std::strcmp(argv[i], "--screenshot-at-distance") == 0) && i + 1 < argc) {
             args.screenshotAtDistance = ParseFloatList(argv[++i]);
+        } else if ((std::strcmp(argv[i], "--record") == 0) && i + 1 < argc) {
+            args.recordPath = argv[++i];
+        } else if ((std::strcmp(argv[i], "--record-format") == 0) && i + 1 < argc) {
+            args.recordFormat = std::strcmp(argv[++i], "raw") == 0 ? render::VideoFormat::Raw
+                                                                   : render::VideoFormat::Y4m;
+        } else if ((std::strcmp(argv[i], "--record-fps") == 0) && i + 1 < argc) {
+            args.recordFps = std::atoi(argv[++i]);
+        } else if ((std::strcmp(argv[i], "--record-timestamps") == 0) && i + 1 < argc) {
+            args.recordTimestamps = argv[++i];
+        } else if (std::strcmp(argv[i], "--offscreen") == 0) {
+            args.offscreen = true;
+        } else if (std::strcmp(argv[i], "--headless") == 0) {
+            args.headless = true;
+            args.offscreen = true;
+        } else if ((std::strcmp(argv[i], "--resolution") == 0) && i + 1 < argc) {
+            int w = 0, h = 0;
+            if (std::sscanf(argv[++i], "%dx%d", &w, &h) == 2 && w > 0 && h > 0) {
+                args.outputWidth = w;
+                args.outputHeight = h;
+            }
+        } else if ((std::strcmp(argv[i], "--msaa") == 0) && i + 1 < argc) {
+            args.msaa = std::atoi(argv[++i]);
         } else if (std::strcmp(argv[i], "--json") == 0) {
             args.json = true;
         } else if (std::strcmp(argv[i], "--quiet") == 0) {
@@ -170,6 +231,70 @@ RunnerArgs ParseArgs(int argc, char* argv[]) {
     return args;
 }
 
+void PrintAllocStatsJson(const char* name, const perf::AllocStats& s, bool last) {
+    std::printf("    \"%s\": {\"allocs\": %llu, \"frees\": %llu, \"bytes\": %llu, "
+                "\"live_bytes\": %lld, \"peak_live_bytes\": %lld}%s\n",
+                name,
+                static_cast<unsigned long long>(s.allocCount),
+                static_cast<unsigned long long>(s.freeCount),
+                static_cast<unsigned long long>(s.bytesAllocated),
+                static_cast<long long>(s.liveBytes),
+                static_cast<long long>(s.peakLiveBytes),
+                last ? "" : ",");
+}
+
+// Draw statistics summed over every rendered frame.
+struct DrawStatsTotals {
+    int frames = 0;
+    render::DrawStats sum;
+};
+
+void AddPassStats(render::PassDrawStats& sum, const render::PassDrawStats& p) {
+    sum.drawCalls += p.drawCalls;
+    sum.batchFlushes += p.batchFlushes;
+    sum.vertices += p.vertices;
+    sum.stateChanges += p.stateChanges;
+}
+
+void AccumulateDrawStats(DrawStatsTotals& totals, const render::DrawStats& frame) {
+    ++totals.frames;
+    for (int i = 0; i < render::kDrawPassCount; ++i) {
+        AddPassStats(totals.sum.passes[i], frame.passes[i]);
+    }
+    AddPassStats(totals.sum.total, frame.total);
+}
+
+// "Power-ups" -> "power_ups"
+std::string DrawPassKey(render::DrawPass pass) {
+    std::string key = render::DrawPassName(pass);
+    for (char& c : key) {
+        c = (c == '-' || c == ' ') ? '_' : static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return key;
+}
+
+void PrintPassStatsJson(const char* name, const render::PassDrawStats& p, int frames, bool last) {
+    const double n = frames > 0 ? static_cast<double>(frames) : 1.0;
+    std::printf("      \"%s\": {\"draw_calls\": %.1f, \"batch_flushes\": %.1f, "
+                "\"vertices\": %.0f, \"state_changes\": %.1f}%s\n",
+                name, p.drawCalls / n, p.batchFlushes / n, p.vertices / n,
+                p.stateChanges / n, last ? "" : ",");
+}
+
+void PrintDrawStatsJson(const DrawStatsTotals& totals) {
+    std::printf("  \"draw_stats\": {\n");
+    std::printf("    \"available\": %s,\n", render::DrawStatsAvailable() ? "true" : "false");
+    std::printf("    \"frames\": %d,\n", totals.frames);
+    std::printf("    \"per_frame\": {\n");
+    for (int i = 0; i < render::kDrawPassCount; ++i) {
+        const auto pass = static_cast<render::DrawPass>(i);
+        PrintPassStatsJson(DrawPassKey(pass).c_str(), totals.sum.passes[i], totals.frames, false);
+    }
+    PrintPassStatsJson("total", totals.sum.total, totals.frames, true);
+    std::printf("    }\n");
+    std::printf("  },\n");
+}
+
 void PrintUsage() {
     std::printf(
         "sim_runner — headless SkyRoads level validator with screenshot support\n"
@@ -183,9 +308,18 @@ void PrintUsage() {
         "  --bloom                       Enable bloom effect\n"
         "  --screenshots                  Enable screenshot capture\n"
         "  --screenshot-output <dir>      Output directory (default: docs/screenshots-raw)\n"
+        "  --screenshot-format <fmt>     png|qoi|raw (default: png)\n"
         "  --screenshot-interval <n>     Take screenshot every N ticks (0 = disabled)\n"
         "  --screenshot-at-ticks <list>   Comma-separated ticks to screenshot (e.g., 1200,6000)\n"
         "  --screenshot-at-distance <list> Comma-separated distances to screenshot (e.g., 100,200)\n"
+        "  --record <path|\"|cmd\">       Stream every rendered frame to a file or pipe\n"
+        "  --record-format <fmt>         y4m|raw (RGB24) (default: y4m)\n"
+        "  --record-fps <n>              Frames per second of sim time (default: 60)\n"
+        "  --record-timestamps <path>    Per-frame tick/time CSV (default: <path>.csv)\n"
+        "  --offscreen                   Render screenshots into a texture, never present\n"
+        "  --headless                    Offscreen without a display server (OSMesa)\n"
+        "  --resolution <WxH>            Screenshot size (default: 1280x720)\n"
+        "  --msaa <0|4>                  Window-path MSAA (default: 4)\n"
         "  --json                        Output as JSON\n"
         "  --quiet                       Only final summary line\n"
         "  -h, --help                    This message\n"
@@ -205,27 +339,29 @@ const char* BotStyleName(BotStyle s) {
 
 std::string GenerateScreenshotFilename(const RunnerArgs& args, int tick, float distance, const Game& /*game*/) {
     char filename[512];
-    std::snprintf(filename, sizeof(filename), "%s/level_%d_palette_%d_tick_%d_dist_%.0f_seed_0x%08X.png",
+    std::snprintf(filename, sizeof(filename), "%s/level_%d_palette_%d_tick_%d_dist_%.0f_seed_0x%08X.%s",
                   args.screenshotOutputDir.c_str(),
                   args.levelIndex,
                   args.paletteIndex,
                   tick,
                   distance,
-                  args.seed);
+                  args.seed,
+                  args.screenshotFormat.c_str());
     return std::string(filename);
 }
 
-void SaveScreenshotMetadata(const std::string& imagePath, const RunnerArgs& args, int tick, const Game& game) {
-    std::string jsonPath = imagePath;
-    size_t dotPos = jsonPath.find_last_of('.');
+std::string ScreenshotMetadataPath(const std::string& imagePath) {
+    const size_t dotPos = imagePath.find_last_of('.');
     if (dotPos != std::string::npos) {
-        jsonPath = jsonPath.substr(0, dotPos) + ".json";
-    } else {
-        jsonPath += ".json";
+        return imagePath.substr(0, dotPos) + ".json";
     }
+    return imagePath + ".json";
+}
 
-    std::ofstream json(jsonPath);
-    if (!json.is_open()) return;
+// JSON sidecar for a screenshot. Built here from the live game state and
+// written by the screenshot worker next to the image.
+std::string FormatScreenshotMetadata(const RunnerArgs& args, int tick, const Game& game) {
+    std::ostringstream json;
 
     const float distance = game.player.position.z - cfg::kPlatformStartZ;
     const float score = GetCurrentScore(game);
@@ -247,7 +383,33 @@ void SaveScreenshotMetadata(const std::string& imagePath, const RunnerArgs& args
     json << "  \"run_time\": " << game.runTime << ",\n";
     json << "  \"timestamp\": \"" << timeStr << "\"\n";
     json << "}\n";
-    json.close();
+    return json.str();
+}
+
+// Ask raylib's bundled GLFW for its null platform. It needs no display
+// server and creates its GL context through OSMesa. Must run before
+// InitWindow.
+bool RequestHeadlessContext() {
+#if defined(SKYROADS_GLFW_NULL_PLATFORM)
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Read the current frame back (from the offscreen target when one is set)
+// and hand it to the screenshot worker, which resizes, encodes and writes
+// it along with its metadata sidecar. Blocks only when the worker is a
+// full queue behind.
+void QueueFrame(const RunnerArgs& args, const std::string& filename, std::string metadata) {
+    render::ScreenshotRequest request;
+    request.path = filename;
+    request.outputWidth = args.outputWidth;
+    request.outputHeight = args.outputHeight;
+    request.sidecarPath = ScreenshotMetadataPath(filename);
+    request.sidecarText = std::move(metadata);
+    render::CaptureScreenshot(std::move(request));
 }
 
 bool ShouldTakeScreenshot(const RunnerArgs& args, int tick, float distance, const Game& /*game*/) {
@@ -280,16 +442,83 @@ int main(int argc, char* argv[]) {
         return 0;
     }
 
-    // --- Initialize raylib and renderer if screenshots are enabled ---
-    if (args.enableScreenshots) {
-        SetConfigFlags(FLAG_WINDOW_HIDDEN | FLAG_MSAA_4X_HINT);
+    // Count everything from here on, including the first level load.
+    perf::ResetAllocStats();
+
+    // --- Initialize raylib and renderer if screenshots or recording are enabled ---
+    const bool recording = !args.recordPath.empty();
+    const bool rendering = args.enableScreenshots || recording;
+    RenderTexture2D frameTarget = {};
+    if (rendering) {
+        unsigned int flags = FLAG_WINDOW_HIDDEN;
+        if (args.offscreen) {
+            if (args.msaa > 0) {
+                std::fprintf(stderr, "[Screenshot] MSAA is not available offscreen; ignoring --msaa\n");
+            }
+        } else if (args.msaa != 0) {
+            flags |= FLAG_MSAA_4X_HINT;
+        }
+        SetConfigFlags(flags);
+        if (args.headless && !RequestHeadlessContext()) {
+            std::fprintf(stderr, "[Screenshot] --headless is not supported on this platform\n");
+            return 2;
+        }
         SetExitKey(0);  // Disable ESC=quit
-        InitWindow(cfg::kScreenWidth, cfg::kScreenHeight, "SkyRoads Screenshot");
+        // Offscreen frames never reach the window; it only provides the context.
+        if (args.offscreen) {
+            InitWindow(64, 64, "SkyRoads Screenshot");
+        } else {
+            InitWindow(cfg::kScreenWidth, cfg::kScreenHeight, "SkyRoads Screenshot");
+        }
+        if (!IsWindowReady()) {
+            std::fprintf(stderr, "[Screenshot] Could not create a GL context\n");
+            return 2;
+        }
         SetTargetFPS(0);  // Disable frame limiting
         InitRenderer();
+        render::SetDrawStatsEnabled(render::DrawStatsAvailable());
+
+        if (args.offscreen) {
+            frameTarget = LoadRenderTexture(cfg::kScreenWidth, cfg::kScreenHeight);
+            if (frameTarget.id == 0) {
+                std::fprintf(stderr, "[Screenshot] Could not create the offscreen target\n");
+                CleanupRenderer();
+                CloseWindow();
+                return 2;
+            }
+            render::SetFrameTarget(&frameTarget);
+        }
         
         // Create output directory
-        CreateDirectoryRecursive(args.screenshotOutputDir);
+        if (args.enableScreenshots) {
+            CreateDirectoryRecursive(args.screenshotOutputDir);
+        }
+    }
+
+    // --- Open the video stream ---
+    // Frames are sampled on the sim clock, so the output rate can't exceed
+    // the tick rate and a recording runs as fast as frames can be rendered.
+    const int simHz = static_cast<int>(1.0f / cfg::kFixedDt + 0.5f);
+    const int recordFps = std::max(1, std::min(args.recordFps, simHz));
+    if (recording) {
+        render::RecorderConfig config;
+        config.path = args.recordPath;
+        config.format = args.recordFormat;
+        config.fps = recordFps;
+        config.timestampPath = args.recordTimestamps;
+        if (config.timestampPath.empty() && args.recordPath[0] != '|') {
+            config.timestampPath = args.recordPath + ".csv";
+        }
+        if (!render::StartRecording(config)) {
+            std::fprintf(stderr, "[Record] Could not open %s\n", args.recordPath.c_str());
+            render::SetFrameTarget(nullptr);
+            if (frameTarget.id != 0) {
+                UnloadRenderTexture(frameTarget);
+            }
+            CleanupRenderer();
+            CloseWindow();
+            return 2;
+        }
     }
 
     // --- Init game state ---
@@ -314,11 +543,31 @@ int main(int argc, char* argv[]) {
     float deathX = 0.0f, deathY = 0.0f, deathZ = 0.0f;
     int lastScreenshotTick = -1;
     float lastScreenshotDistance = -1.0f;
+    int lastRecordedFrame = -1;
+
+    // Render the current tick once, however many captures want it.
+    int renderedTick = -1;
+    DrawStatsTotals drawTotals;
+    auto renderTick = [&]() {
+        if (renderedTick == ticksRun) return;
+        // Process window events to prevent hanging (even for hidden windows)
+        PollInputEvents();
+        game.accumulator = 0.0f; // No interpolation for captures
+        {
+            perf::AllocScope allocScope(perf::AllocTag::Render);
+            RenderFrame(game, 0.0f, cfg::kFixedDt);
+        }
+        AccumulateDrawStats(drawTotals, render::GetDrawStats());
+        renderedTick = ticksRun;
+    };
 
     for (int t = 0; t < args.maxTicks; ++t) {
-        BotInput(bot, game);
-        game.previousPlayer = game.player;
-        SimStep(game, cfg::kFixedDt);
+        {
+            perf::AllocScope allocScope(perf::AllocTag::Sim);
+            BotInput(bot, game);
+            game.previousPlayer = game.player;
+            SimStep(game, cfg::kFixedDt);
+        }
         ++game.simTicks;
         ++ticksRun;
 
@@ -330,22 +579,11 @@ int main(int argc, char* argv[]) {
             if (ShouldTakeScreenshot(args, ticksRun, distance, game)) {
                 // Avoid duplicate screenshots at the same tick/distance
                 if (ticksRun != lastScreenshotTick || std::abs(distance - lastScreenshotDistance) > 1.0f) {
-                    // Process window events to prevent hanging (even for hidden windows)
-                    PollInputEvents();
-                    
-                    // Update camera and render a frame
-                    game.accumulator = 0.0f; // No interpolation for screenshots
-                    const float alpha = 0.0f;
-                    const float renderDt = cfg::kFixedDt;
-                    
-                    RenderFrame(game, alpha, renderDt);
-                    
-                    // Take screenshot
+                    renderTick();
+
+                    // Take screenshot (written with its metadata in the background)
                     std::string filename = GenerateScreenshotFilename(args, ticksRun, distance, game);
-                    TakeScreenshot(filename.c_str());
-                    
-                    // Save metadata
-                    SaveScreenshotMetadata(filename, args, ticksRun, game);
+                    QueueFrame(args, filename, FormatScreenshotMetadata(args, ticksRun, game));
                     
                     if (!args.quiet) {
                         std::fprintf(stderr, "[Screenshot] %s\n", filename.c_str());
@@ -357,6 +595,16 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        // --- Stream a frame whenever the sim clock crosses a frame boundary ---
+        if (recording) {
+            const int frame = static_cast<int>(static_cast<int64_t>(ticksRun) * recordFps / simHz);
+            if (frame != lastRecordedFrame) {
+                renderTick();
+                render::RecordFrame(game.simTicks);
+                lastRecordedFrame = frame;
+            }
+        }
+
         if (!game.runActive) {
             deathX = game.player.position.x;
             deathY = game.player.position.y;
@@ -383,6 +631,8 @@ int main(int argc, char* argv[]) {
     const float difficulty = game.difficultyT;
     const bool survived = game.runActive || game.levelComplete;
     const float perfMsPer1k = (ticksRun > 0) ? (wallMs / (static_cast<float>(ticksRun) / 1000.0f)) : 0.0f;
+    const perf::AllocStats allocTotal = perf::GetTotalAllocStats();
+    const perf::AllocStats allocSim = perf::GetAllocStats(perf::AllocTag::Sim);
 
     // --- Output ---
     if (args.json) {
@@ -401,7 +651,19 @@ int main(int argc, char* argv[]) {
         std::printf("  \"death_cause\": \"%s\",\n", deathCause);
         std::printf("  \"death_pos\": [%.2f, %.2f, %.2f],\n", deathX, deathY, deathZ);
         std::printf("  \"wall_ms\": %.2f,\n", wallMs);
-        std::printf("  \"perf_ms_per_1k\": %.3f\n", perfMsPer1k);
+        std::printf("  \"perf_ms_per_1k\": %.3f,\n", perfMsPer1k);
+        if (rendering) {
+            PrintDrawStatsJson(drawTotals);
+        }
+        std::printf("  \"alloc_tracking\": %s,\n", perf::kAllocTrackingEnabled ? "true" : "false");
+        std::printf("  \"memory\": {\n");
+        PrintAllocStatsJson("total", allocTotal, false);
+        for (int i = 0; i < perf::kAllocTagCount; ++i) {
+            const auto tag = static_cast<perf::AllocTag>(i);
+            PrintAllocStatsJson(perf::GetAllocTagName(tag), perf::GetAllocStats(tag),
+                                i == perf::kAllocTagCount - 1);
+        }
+        std::printf("  }\n");
         std::printf("}\n");
     } else if (args.quiet) {
         std::printf("seed=0x%08X  level=%d  status=%-8s  score=%-10.0f  dist=%-8.1f  time=%-7.2fs  diff=%.3f  perf=%.3fms/1k\n",
@@ -425,10 +687,36 @@ int main(int argc, char* argv[]) {
         }
         std::printf("wall_time:  %.2f ms\n", wallMs);
         std::printf("perf:       %.3f ms / 1000 ticks\n", perfMsPer1k);
+        if (rendering && render::DrawStatsAvailable() && drawTotals.frames > 0) {
+            const render::PassDrawStats& t = drawTotals.sum.total;
+            const double n = static_cast<double>(drawTotals.frames);
+            std::printf("draws:      %.1f calls, %.1f flushes, %.1fk verts, %.1f binds / frame (%d frames)\n",
+                        t.drawCalls / n, t.batchFlushes / n, t.vertices / n / 1000.0,
+                        t.stateChanges / n, drawTotals.frames);
+        }
+        if (perf::kAllocTrackingEnabled) {
+            std::printf("allocs:     %llu sim / %llu total (peak %.1f KB)\n",
+                        static_cast<unsigned long long>(allocSim.allocCount),
+                        static_cast<unsigned long long>(allocTotal.allocCount),
+                        static_cast<double>(allocTotal.peakLiveBytes) / 1024.0);
+        }
     }
 
-    // --- Cleanup renderer and window if screenshots were enabled ---
-    if (args.enableScreenshots) {
+    // --- Cleanup renderer and window if screenshots or recording were enabled ---
+    if (recording) {
+        render::StopRecording();
+        const render::RecorderStats stats = render::GetRecorderStats();
+        if (!args.quiet) {
+            std::fprintf(stderr, "[Record] %s: %d frames at %dx%d, %d dropped, %d stalls\n",
+                         args.recordPath.c_str(), stats.framesWritten, stats.width,
+                         stats.height, stats.framesDropped, stats.stalls);
+        }
+    }
+    if (rendering) {
+        render::SetFrameTarget(nullptr);
+        if (frameTarget.id != 0) {
+            UnloadRenderTexture(frameTarget);
+        }
         CleanupRenderer();
         CloseWindow();
     }